@@ -0,0 +1,263 @@
+/*
+ * MAX6921_Effects.cpp
+ *
+ * Implementation file for non-blocking display effects
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+
+MAX6921_EffectEngine::MAX6921_EffectEngine(MAX6921_VFD_Driver* driver)
+    : _driver(driver), _activeCount(0), _nextOrder(0), _levelsChanged(false) {
+    memset(_effects, 0, sizeof(_effects));
+}
+
+// 빈 슬롯에 효과 등록 (겹치는 앞 효과가 없으면 바로 시작)
+int8_t MAX6921_EffectEngine::add(uint8_t type, uint8_t first, uint8_t count, uint16_t intervalMs) {
+    if (count == 0 || count > MAX6921_EFFECT_MAX_DIGITS || first >= _driver->_numGrids || count > _driver->_numGrids - first) {
+        return -1;
+    }
+
+    for (uint8_t slot = 0; slot < MAX6921_MAX_EFFECTS; slot++) {
+        Effect& effect = _effects[slot];
+        if (effect.state != STATE_IDLE) continue;
+
+        memset(&effect, 0, sizeof(Effect));
+        effect.type = type;
+        effect.state = STATE_WAITING;
+        effect.first = first;
+        effect.count = count;
+        effect.order = _nextOrder++;
+        effect.intervalMs = intervalMs;
+        _activeCount++;
+        return (int8_t)slot;
+    }
+    return -1;
+}
+
+int8_t MAX6921_EffectEngine::marquee(const char* text, uint8_t first, uint8_t count, uint16_t stepMs, bool repeat) {
+    if (text == NULL) return -1;
+    int8_t id = add(MAX6921_EFFECT_MARQUEE, first, count, stepMs);
+    if (id < 0) return id;
+
+    Effect& effect = _effects[id];
+    size_t length = strlen(text);
+    effect.text = text;
+    effect.textLength = (length > (size_t)(255 - count)) ? (uint8_t)(255 - count) : (uint8_t)length;
+    effect.repeat = repeat;
+    effect.steps = effect.textLength + count;   // 오른쪽 끝에서 들어와 왼쪽 끝으로 완전히 빠질 때까지
+    update();
+    return id;
+}
+
+// times = 꺼짐 횟수 (0 = stop()까지 반복), 주기의 절반씩 꺼짐/켜짐
+int8_t MAX6921_EffectEngine::blink(uint8_t first, uint8_t count, uint16_t periodMs, uint8_t times) {
+    int8_t id = add(MAX6921_EFFECT_BLINK, first, count, periodMs / 2);
+    if (id < 0) return id;
+
+    _effects[id].steps = (uint16_t)times * 2;
+    update();
+    return id;
+}
+
+int8_t MAX6921_EffectEngine::wipe(const char* text, uint8_t first, uint8_t count, uint16_t stepMs) {
+    if (text == NULL) return -1;
+    int8_t id = add(MAX6921_EFFECT_WIPE, first, count, stepMs);
+    if (id < 0) return id;
+
+    Effect& effect = _effects[id];
+    strncpy(effect.buffer, text, count);
+    effect.steps = count;
+    update();
+    return id;
+}
+
+int8_t MAX6921_EffectEngine::crossfade(const char* text, uint8_t first, uint8_t count, uint16_t durationMs) {
+    if (text == NULL) return -1;
+    int8_t id = add(MAX6921_EFFECT_CROSSFADE, first, count, durationMs);
+    if (id < 0) return id;
+
+    strncpy(_effects[id].buffer, text, count);
+    update();
+    return id;
+}
+
+void MAX6921_EffectEngine::stop(int8_t id) {
+    if (id < 0 || id >= MAX6921_MAX_EFFECTS || _effects[id].state == STATE_IDLE) return;
+
+    finish(_effects[id]);
+    publish();
+}
+
+void MAX6921_EffectEngine::stopAll() {
+    for (int8_t id = 0; id < MAX6921_MAX_EFFECTS; id++) {
+        stop(id);
+    }
+}
+
+bool MAX6921_EffectEngine::isActive(int8_t id) {
+    return id >= 0 && id < MAX6921_MAX_EFFECTS && _effects[id].state != STATE_IDLE;
+}
+
+// 실행/대기 중인 마퀴의 문자열 (마퀴가 아니거나 끝난 슬롯은 NULL)
+// 효과 번호는 끝나면 다른 효과에 다시 쓰이므로 자기 문자열인지로 소유를 확인할 수 있음
+const char* MAX6921_EffectEngine::getMarqueeText(int8_t id) {
+    if (!isActive(id) || _effects[id].type != MAX6921_EFFECT_MARQUEE) return NULL;
+    return _effects[id].text;
+}
+
+bool MAX6921_EffectEngine::isIdle() {
+    return _activeCount == 0;
+}
+
+// 효과 진행: 슬롯마다 최대 1단계 (자릿수만큼 그리기) 후 publish() 1회
+void MAX6921_EffectEngine::update() {
+    if (_activeCount == 0) return;
+
+    unsigned long now = millis();
+    bool stepped = false;
+
+    for (uint8_t slot = 0; slot < MAX6921_MAX_EFFECTS; slot++) {
+        Effect& effect = _effects[slot];
+
+        if (effect.state == STATE_WAITING) {
+            if (blocked(slot)) continue;
+            startEffect(effect, now);
+        } else if (effect.state == STATE_RUNNING) {
+            if (effect.type != MAX6921_EFFECT_CROSSFADE && now - effect.lastStepMs < effect.intervalMs) continue;
+            if (!stepEffect(effect, now)) finish(effect);
+        } else {
+            continue;
+        }
+        stepped = true;
+    }
+
+    if (stepped) publish();
+}
+
+// 레벨이 바뀐 경우에만 표시 시간 재계산, 그린 문자는 autoPresent일 때만 화면으로 넘김
+// (바뀐 그리드가 없으면 present()는 바로 반환)
+void MAX6921_EffectEngine::publish() {
+    if (_levelsChanged) {
+        _levelsChanged = false;
+        _driver->updateBlankTiming();
+    }
+    _driver->autoPresent();
+}
+
+// 범위가 겹치고 먼저 등록된 효과가 남아 있으면 대기
+bool MAX6921_EffectEngine::blocked(uint8_t slot) {
+    const Effect& self = _effects[slot];
+
+    for (uint8_t other = 0; other < MAX6921_MAX_EFFECTS; other++) {
+        const Effect& effect = _effects[other];
+        if (other == slot || effect.state == STATE_IDLE) continue;
+        if ((int8_t)(effect.order - self.order) >= 0) continue;          // 나중에 등록됨
+        if (effect.first >= self.first + self.count || self.first >= effect.first + effect.count) continue;
+        return true;
+    }
+    return false;
+}
+
+void MAX6921_EffectEngine::startEffect(Effect& effect, unsigned long now) {
+    effect.state = STATE_RUNNING;
+    effect.step = 0;
+    effect.lastStepMs = now;
+
+    // 첫 단계는 바로 표시 (크로스페이드는 시작 시각만 기록)
+    if (effect.type != MAX6921_EFFECT_CROSSFADE) {
+        stepEffect(effect, now);
+    }
+}
+
+// 효과 1단계 진행
+bool MAX6921_EffectEngine::stepEffect(Effect& effect, unsigned long now) {
+    if (effect.type == MAX6921_EFFECT_CROSSFADE) {
+        // 시간 기준: 앞 절반은 어두워지고, 중간에 문자열 교체, 뒤 절반은 밝아짐
+        unsigned long elapsed = now - effect.lastStepMs;
+        if (elapsed < (unsigned long)effect.step * MAX6921_EFFECT_FADE_STEP_MS) return true;
+        effect.step++;
+
+        uint16_t half = effect.intervalMs / 2;
+        if (elapsed >= effect.intervalMs || half == 0) {
+            if (effect.steps == 0) {
+                for (uint8_t i = 0; i < effect.count; i++) {
+                    _driver->drawCharacter(effect.first + i, bufferChar(effect, i));
+                }
+            }
+            return false;
+        }
+        if (elapsed < half) {
+            setLevel(effect, (uint8_t)(255 - (255UL * elapsed) / half));
+        } else {
+            if (effect.steps == 0) {
+                for (uint8_t i = 0; i < effect.count; i++) {
+                    _driver->drawCharacter(effect.first + i, bufferChar(effect, i));
+                }
+                effect.steps = 1;         // 문자열 교체 완료 표시
+            }
+            setLevel(effect, (uint8_t)((255UL * (elapsed - half)) / half));
+        }
+        return true;
+    }
+
+    // 일정 간격 효과: 늦어져도 한 번에 한 단계만 (밀린 단계를 몰아서 하지 않음)
+    if (now - effect.lastStepMs >= 2UL * effect.intervalMs) {
+        effect.lastStepMs = now;
+    } else if (effect.step > 0) {
+        effect.lastStepMs += effect.intervalMs;
+    }
+
+    if (effect.steps != 0 && effect.step >= effect.steps) {
+        if (!effect.repeat) return false;
+        effect.step = 0;
+    }
+
+    uint16_t step = effect.step++;
+
+    switch (effect.type) {
+    case MAX6921_EFFECT_MARQUEE:
+        for (uint8_t pos = 0; pos < effect.count; pos++) {
+            int16_t index = (int16_t)step + pos - effect.count + 1;
+            char ch = (index >= 0 && index < effect.textLength) ? effect.text[index] : ' ';
+            _driver->drawCharacter(effect.first + pos, ch);
+        }
+        break;
+
+    case MAX6921_EFFECT_BLINK:
+        setLevel(effect, (step & 1) ? 255 : 0);
+        break;
+
+    case MAX6921_EFFECT_WIPE:
+        _driver->drawCharacter(effect.first + step, bufferChar(effect, step));
+        break;
+    }
+    return true;
+}
+
+void MAX6921_EffectEngine::finish(Effect& effect) {
+    if (effect.type == MAX6921_EFFECT_BLINK || effect.type == MAX6921_EFFECT_CROSSFADE) {
+        setLevel(effect, 255);
+    }
+    effect.state = STATE_IDLE;
+    _activeCount--;
+}
+
+void MAX6921_EffectEngine::setLevel(const Effect& effect, uint8_t level) {
+    for (uint8_t i = 0; i < effect.count; i++) {
+        uint8_t& current = _driver->_gridEffectLevel[effect.first + i];
+        if (current != level) {
+            current = level;
+            _levelsChanged = true;
+        }
+    }
+}
+
+// 복사한 문자열이 범위보다 짧으면 나머지는 공백
+char MAX6921_EffectEngine::bufferChar(const Effect& effect, uint8_t index) {
+    char ch = effect.buffer[index];
+    return (ch == '\0') ? ' ' : ch;
+}
@@ -0,0 +1,110 @@
+/*
+ * MAX6921_Effects.h
+ *
+ * 논블로킹 표시 효과 (마퀴 스크롤, 깜박임, 와이프, 크로스페이드)
+ *
+ * 효과는 드라이버 안의 고정 크기 슬롯 테이블에 들어가며 (동적 할당 없음)
+ * refresh()가 호출될 때마다 update()로 조금씩 진행된다. 한 번의 update()는
+ * 슬롯 수 x 자릿수 이내의 일만 하므로 스캔 주기를 늘리지 않는다.
+ * (타이머 스캔 모드에서도 효과는 loop()의 refresh()에서 진행되고 ISR은 관여하지 않음)
+ *
+ * - 효과마다 자릿수 범위(first, count)를 가지며 범위가 겹치지 않으면 동시에 실행됨
+ * - 실행 중인 효과와 범위가 겹치는 새 효과는 대기열에 들어가 앞 효과가 끝나면 시작
+ *   (무한 반복 효과 뒤에 대기 중인 효과는 stop()으로 앞 효과를 끝내야 시작됨)
+ * - 깜박임/크로스페이드는 그리드별 표시 시간(BLANK PWM)만 조절하므로 문자를 다시 그리지 않음
+ *   (표시 시간은 레벨이 실제로 바뀐 update()에서만 다시 계산)
+ * - 효과가 그린 문자는 autoPresent가 켜져 있으면 update()가 바로 present()
+ *   setAutoPresent(false)로 직접 화면을 넘기는 중이면 back 버퍼에만 그리고 다음 present()에 함께 표시
+ *   (그리던 중인 화면이 효과 때문에 먼저 넘어가지 않음)
+ *
+ *   vfd.effects().marquee("HELLO WORLD", 0, 7, 200, true);
+ *   vfd.effects().blink(5, 2, 500);
+ *   ...
+ *   loop() { vfd.refresh(); }
+ *
+ * marquee()의 문자열은 효과가 끝날 때까지 유지되어야 함 (복사하지 않음, NULL이면 -1)
+ * wipe()/crossfade()의 문자열은 범위 길이만큼 복사됨
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_EFFECTS_H
+#define MAX6921_EFFECTS_H
+
+#include <Arduino.h>
+
+#define MAX6921_MAX_EFFECTS           4     // 동시에 등록 가능한 효과 수
+#define MAX6921_EFFECT_MAX_DIGITS     VFD_MAX_GRIDS  // 효과 범위 최대 자릿수 (저장소 용량, VFD 설정을 먼저 include)
+#define MAX6921_EFFECT_FADE_STEP_MS   20    // 크로스페이드 갱신 간격
+
+class MAX6921_VFD_Driver;
+
+enum MAX6921_EffectType {
+    MAX6921_EFFECT_NONE = 0,
+    MAX6921_EFFECT_MARQUEE,               // 오른쪽에서 들어와 왼쪽으로 흐르는 문자열
+    MAX6921_EFFECT_BLINK,                 // 범위 전체 켜기/끄기 반복
+    MAX6921_EFFECT_WIPE,                  // 왼쪽부터 한 자리씩 새 문자열로 교체
+    MAX6921_EFFECT_CROSSFADE              // 어두워진 뒤 새 문자열로 바꾸고 다시 밝아짐
+};
+
+class MAX6921_EffectEngine {
+private:
+    enum State {
+        STATE_IDLE = 0,
+        STATE_WAITING,                    // 겹치는 범위의 앞 효과가 끝나기를 기다림
+        STATE_RUNNING
+    };
+
+    struct Effect {
+        uint8_t type;
+        uint8_t state;
+        uint8_t first;                    // 시작 자리 (그리드)
+        uint8_t count;                    // 자릿수
+        uint8_t order;                    // 등록 순서 (대기열 순서 판정)
+        bool repeat;
+        uint16_t intervalMs;              // 단계 간격 (크로스페이드는 전체 시간)
+        uint16_t step;                    // 현재 단계
+        uint16_t steps;                   // 전체 단계 수 (0 = 무한)
+        unsigned long lastStepMs;
+        const char* text;                 // marquee: 호출한 쪽 문자열
+        uint8_t textLength;
+        char buffer[MAX6921_EFFECT_MAX_DIGITS];  // wipe/crossfade: 새 문자열 복사본
+    };
+
+    MAX6921_VFD_Driver* _driver;
+    Effect _effects[MAX6921_MAX_EFFECTS];
+    uint8_t _activeCount;                 // IDLE이 아닌 슬롯 수 (0이면 update() 즉시 반환)
+    uint8_t _nextOrder;
+    bool _levelsChanged;                  // 이번 update()에서 그리드 레벨이 바뀜 (표시 시간 재계산 필요)
+
+    int8_t add(uint8_t type, uint8_t first, uint8_t count, uint16_t intervalMs);
+    bool blocked(uint8_t slot);           // 겹치는 범위에 먼저 등록된 효과가 있음
+    void startEffect(Effect& effect, unsigned long now);
+    bool stepEffect(Effect& effect, unsigned long now);  // false = 효과 종료
+    void finish(Effect& effect);
+    void setLevel(const Effect& effect, uint8_t level);
+    void publish();                       // 레벨 변경 반영 + autoPresent이면 present()
+    char bufferChar(const Effect& effect, uint8_t index);
+
+public:
+    MAX6921_EffectEngine(MAX6921_VFD_Driver* driver);
+
+    // 효과 등록 (반환값: 효과 번호, 슬롯이 없거나 범위가 잘못되거나 문자열이 NULL이면 -1)
+    int8_t marquee(const char* text, uint8_t first, uint8_t count, uint16_t stepMs, bool repeat = true);
+    int8_t blink(uint8_t first, uint8_t count, uint16_t periodMs, uint8_t times = 0);
+    int8_t wipe(const char* text, uint8_t first, uint8_t count, uint16_t stepMs);
+    int8_t crossfade(const char* text, uint8_t first, uint8_t count, uint16_t durationMs);
+
+    void stop(int8_t id);
+    void stopAll();
+    bool isActive(int8_t id);
+    const char* getMarqueeText(int8_t id);  // 실행 중인 마퀴가 아니면 NULL
+    bool isIdle();
+
+    // refresh()에서 호출 (슬롯 수 x 자릿수 이내의 고정 비용)
+    void update();
+};
+
+#endif // MAX6921_EFFECTS_H
@@ -0,0 +1,158 @@
+/*
+ * MAX6921_GPIOTransport.h
+ *
+ * 하드웨어 SPI 없이 GPIO로 MAX6921 체인을 구동하는 전송 계층
+ * (SPI가 Ethernet/SD 등 다른 장치에 묶여 있는 보드용)
+ *
+ * 핀 번호를 템플릿 인자로 받아 컴파일 타임에 포트 레지스터와 비트 마스크를
+ * 결정하므로, 비트마다 digitalWrite()의 핀 조회 없이 sbi/cbi 명령 한 개로 출력함.
+ *
+ *   MAX6921_GPIOTransport<7, 6, 5> gpio;   // DIN, CLK, LOAD
+ *   vfd.setTransport(&gpio);
+ *
+ * ===== 타이밍 (MAX6921 데이터시트 Serial-Interface Timing) =====
+ *
+ * - DIN은 CLK 상승 에지에서 샘플링, MSB First
+ * - 최소 시간은 아래 MAX6921_GPIO_*_NS 값(데이터시트 tDS/tDH/tCH/tCL/tCP/tCSH/tCSW)으로 정의하고,
+ *   F_CPU 기준 사이클 수로 환산하여 명령 실행 시간으로 부족한 만큼만 지연을 삽입
+ *   (고정 delayMicroseconds 없음)
+ * - CLK HIGH 구간 = max(tCH, tDH), LOW 구간 = max(tCL, tCP - HIGH 구간)이므로 클록 주기와
+ *   DIN 유지 시간도 함께 보장됨
+ * - 16MHz AVR에서는 포트 명령 1개(2사이클 = 125ns)가 대부분의 최소 시간보다 길어 지연이 거의 없음
+ *
+ * 프레임 형식은 MAX6921_Transport.h와 동일 (SPI 전송과 같은 비트열)
+ *
+ * 포트 직접 접근은 ATmega328P/168 (Uno, Nano, Pro Mini) 핀 배치를 지원하며,
+ * 그 외 보드에서는 digitalWrite()로 동작함 (MAX6921_FastPin 특수화를 추가하면 됨)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_GPIO_TRANSPORT_H
+#define MAX6921_GPIO_TRANSPORT_H
+
+#include <Arduino.h>
+#include "MAX6921_Transport.h"
+
+// MAX6921 직렬 인터페이스 최소 시간 (ns, 데이터시트 Timing Characteristics)
+#define MAX6921_GPIO_DIN_SETUP_NS   5     // tDS: DIN 설정 → CLK 상승
+#define MAX6921_GPIO_DIN_HOLD_NS    20    // tDH: CLK 상승 → DIN 변경 (3.0-4.5V 기준, 5V는 15)
+#define MAX6921_GPIO_CLK_HIGH_NS    90    // tCH: CLK HIGH 폭
+#define MAX6921_GPIO_CLK_LOW_NS     90    // tCL: CLK LOW 폭
+#define MAX6921_GPIO_CLK_PERIOD_NS  200   // tCP: CLK 주기 (5MHz)
+#define MAX6921_GPIO_LOAD_SETUP_NS  100   // tCSH: 마지막 CLK 상승 → LOAD 상승
+#define MAX6921_GPIO_LOAD_HIGH_NS   55    // tCSW: LOAD HIGH 폭
+
+// 비트 1개의 CLK HIGH/LOW 구간 (LOW 구간에는 다음 DIN 설정 시간이 포함되므로 그만큼 뺌)
+#define MAX6921_GPIO_MAX_NS(a, b)   ((a) > (b) ? (a) : (b))
+#define MAX6921_GPIO_HIGH_PHASE_NS  MAX6921_GPIO_MAX_NS(MAX6921_GPIO_CLK_HIGH_NS, MAX6921_GPIO_DIN_HOLD_NS)
+#define MAX6921_GPIO_LOW_PHASE_NS   (MAX6921_GPIO_MAX_NS(MAX6921_GPIO_CLK_LOW_NS, \
+                                        MAX6921_GPIO_CLK_PERIOD_NS - MAX6921_GPIO_HIGH_PHASE_NS) - \
+                                     MAX6921_GPIO_DIN_SETUP_NS)
+
+// 포트 명령 1회에 걸리는 최소 사이클 (AVR sbi/cbi)
+#define MAX6921_GPIO_PIN_CYCLES     2
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__)
+#define MAX6921_HAS_FAST_GPIO 1
+#else
+#define MAX6921_HAS_FAST_GPIO 0
+#endif
+
+// 최소 시간(ns)을 맞추기 위한 추가 지연 (포트 명령 자체 시간을 뺀 나머지만)
+// AVR 외 보드는 루프 1회를 1사이클 이상으로 보고 NOP 루프 (빠른 MCU에서도 최소 시간 보장)
+// 호스트 테스트는 MAX6921_DELAY_CYCLES(shim의 사이클 시계)로 지연 사이클을 기록
+template<uint32_t Ns>
+inline void max6921DelayNs() {
+    const uint32_t cycles = (Ns * (F_CPU / 1000000UL) + 999) / 1000;
+    if (cycles > MAX6921_GPIO_PIN_CYCLES) {
+#if defined(__AVR__)
+        __builtin_avr_delay_cycles(cycles - MAX6921_GPIO_PIN_CYCLES);
+#elif defined(MAX6921_DELAY_CYCLES)
+        MAX6921_DELAY_CYCLES(cycles - MAX6921_GPIO_PIN_CYCLES);
+#else
+        for (uint32_t i = 0; i < cycles - MAX6921_GPIO_PIN_CYCLES; i++) {
+            __asm__ __volatile__ ("nop");
+        }
+#endif
+    }
+}
+
+// 컴파일 타임 핀 → 포트 레지스터/마스크
+// 핀 번호가 상수이므로 분기는 컴파일 시 사라지고 sbi/cbi 한 개만 남음
+template<uint8_t Pin>
+struct MAX6921_FastPin {
+#if MAX6921_HAS_FAST_GPIO
+    static_assert(Pin < 20, "fast GPIO supports D0-D19 (A0-A5) on ATmega328P/168");
+    static const uint8_t mask = (uint8_t)(1 << ((Pin < 8) ? Pin : (Pin < 14) ? (Pin - 8) : (Pin - 14)));
+
+    static inline void output() {
+        if (Pin < 8)       DDRD |= mask;
+        else if (Pin < 14) DDRB |= mask;
+        else               DDRC |= mask;
+    }
+    static inline void high() {
+        if (Pin < 8)       PORTD |= mask;
+        else if (Pin < 14) PORTB |= mask;
+        else               PORTC |= mask;
+    }
+    static inline void low() {
+        if (Pin < 8)       PORTD &= (uint8_t)~mask;
+        else if (Pin < 14) PORTB &= (uint8_t)~mask;
+        else               PORTC &= (uint8_t)~mask;
+    }
+#else
+    static inline void output() { pinMode(Pin, OUTPUT); }
+    static inline void high() { digitalWrite(Pin, HIGH); }
+    static inline void low() { digitalWrite(Pin, LOW); }
+#endif
+    static inline void write(bool level) {
+        if (level) high(); else low();
+    }
+};
+
+// GPIO 비트뱅 전송
+template<uint8_t DinPin, uint8_t ClkPin, uint8_t LoadPin>
+class MAX6921_GPIOTransport : public MAX6921_Transport {
+private:
+    typedef MAX6921_FastPin<DinPin> Din;
+    typedef MAX6921_FastPin<ClkPin> Clk;
+    typedef MAX6921_FastPin<LoadPin> Load;
+
+public:
+    virtual void begin() {
+        Din::output();
+        Clk::output();
+        Load::output();
+        Din::low();
+        Clk::low();
+        Load::high();     // 대기 HIGH: 래치 투명 (전송 중에만 LOW, 상승 에지에서 새 프레임 래치)
+        max6921DelayNs<MAX6921_GPIO_LOAD_HIGH_NS>();
+    }
+
+    // SPI 전송과 같은 순서: LOAD LOW → 바이트별 MSB First 시프트 → LOAD HIGH
+    virtual void send(const uint8_t* frame, uint8_t length) {
+        Load::low();
+
+        for (uint8_t i = 0; i < length; i++) {
+            uint8_t data = frame[i];
+            for (uint8_t bit = 0x80; bit != 0; bit >>= 1) {
+                Din::write(data & bit);
+                max6921DelayNs<MAX6921_GPIO_DIN_SETUP_NS>();
+                Clk::high();
+                max6921DelayNs<MAX6921_GPIO_HIGH_PHASE_NS>();
+                Clk::low();
+                max6921DelayNs<MAX6921_GPIO_LOW_PHASE_NS>();
+            }
+        }
+
+        max6921DelayNs<MAX6921_GPIO_LOAD_SETUP_NS>();
+        Load::high();
+        max6921DelayNs<MAX6921_GPIO_LOAD_HIGH_NS>();   // 바로 다음 send()의 LOAD LOW까지
+        notifyTransferComplete();
+    }
+};
+
+#endif // MAX6921_GPIO_TRANSPORT_H
@@ -0,0 +1,66 @@
+/*
+ * MAX6921_GlyphCache.cpp
+ *
+ * Implementation file for the user-defined glyph cache
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_GlyphCache.h"
+
+MAX6921_GlyphCache::MAX6921_GlyphCache() {
+    clear();
+}
+
+bool MAX6921_GlyphCache::define(uint16_t codePoint, uint32_t pattern) {
+    if (codePoint == 0) return false;
+
+    int8_t slot = find(codePoint);
+    if (slot < 0) {
+        for (uint8_t i = 0; i < MAX6921_GLYPH_CACHE_SIZE; i++) {
+            if (_codes[i] == 0) {
+                slot = (int8_t)i;
+                break;
+            }
+        }
+        if (slot < 0) return false;
+        _codes[slot] = codePoint;
+        _count++;
+    }
+    _patterns[slot] = pattern;
+    return true;
+}
+
+bool MAX6921_GlyphCache::remove(uint16_t codePoint) {
+    int8_t slot = find(codePoint);
+    if (slot < 0) return false;
+
+    _codes[slot] = 0;
+    _patterns[slot] = 0;
+    _count--;
+    return true;
+}
+
+void MAX6921_GlyphCache::clear() {
+    memset(_codes, 0, sizeof(_codes));
+    memset(_patterns, 0, sizeof(_patterns));
+    _count = 0;
+}
+
+int8_t MAX6921_GlyphCache::find(uint16_t codePoint) const {
+    if (_count == 0 || codePoint == 0) return -1;
+
+    for (uint8_t i = 0; i < MAX6921_GLYPH_CACHE_SIZE; i++) {
+        if (_codes[i] == codePoint) return (int8_t)i;
+    }
+    return -1;
+}
+
+// 등록된 글리프가 우선, 그다음 ASCII는 그대로 (플래시 폰트), 나머지는 대체 글리프
+uint8_t MAX6921_GlyphCache::cellCode(uint16_t codePoint) const {
+    int8_t slot = find(codePoint);
+    if (slot >= 0) return (uint8_t)(MAX6921_GLYPH_FIRST_CODE + slot);
+    return (codePoint < 0x80) ? (uint8_t)codePoint : MAX6921_GLYPH_UNKNOWN;
+}
@@ -0,0 +1,70 @@
+/*
+ * MAX6921_GlyphCache.h
+ *
+ * 사용자 정의 글리프 캐시 (RAM, 고정 크기 슬롯)
+ *
+ * 폰트에 없는 문자(단위, 화살표, 도 기호, 한글 메뉴 약어 등)를 코드 포인트별로 등록해 두면
+ * 문자 조회가 플래시 폰트보다 먼저 이 캐시를 본다. 같은 코드 포인트를 다시 등록하면 패턴만 바뀌고
+ * ASCII 문자를 등록하면 내장 폰트 패턴을 덮어쓴다.
+ *
+ * 문자열의 UTF-8 문자는 배치 단계에서 한 번만 코드 포인트 → 슬롯으로 바뀌어 자리 문자 캐시에
+ * 슬롯 코드(MAX6921_GLYPH_FIRST_CODE + 슬롯)로 저장된다. 이후 그리기의 적중 경로는 슬롯 직접 인덱싱
+ * (O(1))이고, 스캔은 미리 인코딩된 프레임만 보내므로 사용자 글리프도 내장 문자와 프레임당 비용이 같다.
+ *
+ *   vfd.defineGlyph("°", degreePattern);     // UTF-8 소스 문자 (패턴은 현재 튜브의 세그먼트 비트)
+ *   vfd.defineGlyph(0x2192, arrowPattern);   // 코드 포인트 (→)
+ *   vfd.displayString("25°C");
+ *
+ * 한 바이트 이스케이프("\xB0")는 Latin-1 코드 포인트로 해석되므로 효과(marquee 등)처럼
+ * 바이트 단위로 그리는 경로에서도 같은 글리프가 나온다.
+ *
+ * 슬롯 코드는 0x80부터 쓰므로 캐시는 최대 127슬롯이다. 코드 포인트 0은 빈 슬롯 표시로 쓰여 등록할 수 없다.
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_GLYPH_CACHE_H
+#define MAX6921_GLYPH_CACHE_H
+
+#include <Arduino.h>
+
+#ifndef MAX6921_GLYPH_CACHE_SIZE
+#define MAX6921_GLYPH_CACHE_SIZE  8       // 사용자 글리프 슬롯 수 (슬롯당 RAM 6바이트)
+#endif
+
+#define MAX6921_GLYPH_FIRST_CODE  0x80    // 자리 문자 캐시에서 슬롯 0의 코드
+#define MAX6921_GLYPH_UNKNOWN     0x7F    // 폰트/캐시 어디에도 없는 문자 (대체 글리프로 표시)
+#define MAX6921_GLYPH_INVALID     0xFFFD  // 해석할 수 없는 UTF-8 (BMP 밖 문자)
+
+static_assert(MAX6921_GLYPH_CACHE_SIZE > 0 && MAX6921_GLYPH_CACHE_SIZE < 0x80, "glyph slot codes must fit in 0x80-0xFE");
+
+class MAX6921_GlyphCache {
+private:
+    uint16_t _codes[MAX6921_GLYPH_CACHE_SIZE];     // 슬롯별 코드 포인트 (0 = 빈 슬롯)
+    uint32_t _patterns[MAX6921_GLYPH_CACHE_SIZE];  // 슬롯별 세그먼트 패턴
+    uint8_t _count;
+
+public:
+    MAX6921_GlyphCache();
+
+    bool define(uint16_t codePoint, uint32_t pattern);   // 같은 코드면 교체, 슬롯이 없으면 false
+    bool remove(uint16_t codePoint);
+    void clear();
+
+    int8_t find(uint16_t codePoint) const;         // 슬롯 번호, 없으면 -1
+    uint8_t cellCode(uint16_t codePoint) const;    // 코드 포인트 → 자리 문자 코드 (슬롯 / ASCII / UNKNOWN)
+    uint8_t getCount() const { return _count; }
+    uint16_t getCodePoint(uint8_t slot) const { return (slot < MAX6921_GLYPH_CACHE_SIZE) ? _codes[slot] : 0; }
+
+    // 적중 경로: 자리 문자 코드 → 패턴 (슬롯 직접 인덱싱, 슬롯 코드가 아니거나 빈 슬롯이면 false)
+    bool lookup(uint8_t code, uint32_t& pattern) const {
+        uint8_t slot = code - MAX6921_GLYPH_FIRST_CODE;
+        if (slot >= MAX6921_GLYPH_CACHE_SIZE || _codes[slot] == 0) return false;
+        pattern = _patterns[slot];
+        return true;
+    }
+};
+
+#endif // MAX6921_GLYPH_CACHE_H
@@ -0,0 +1,82 @@
+/*
+ * MAX6921_GridStore.h
+ *
+ * 그리드별 세그먼트 마스크 저장소 (튜브 형상에 맞춰 컴파일 타임에 크기 결정)
+ *
+ * 세그먼트 수에 따라 가장 작은 정수형을 골라 그리드 수만큼만 저장한다.
+ *   ~8 세그먼트: uint8_t, ~16: uint16_t, ~32: uint32_t, ~64: uint64_t
+ * 세그먼트 비트 연산도 같은 형으로 수행하므로 7BT317NK(21세그먼트)에서는
+ * 64비트 시프트가 생기지 않는다 (AVR에서 64비트 시프트는 라이브러리 호출).
+ *
+ *   7BT317NK: MAX6921_GridStore<7, 21> → uint32_t x 7 = 28바이트 (기존 uint64_t x 16 = 128바이트)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_GRID_STORE_H
+#define MAX6921_GRID_STORE_H
+
+#include <Arduino.h>
+
+// 세그먼트 수 → 저장 형
+template<bool Fits8, bool Fits16, bool Fits32>
+struct MAX6921_SegmentMaskSelect { typedef uint64_t type; };
+template<bool Fits8, bool Fits16>
+struct MAX6921_SegmentMaskSelect<Fits8, Fits16, true> { typedef uint32_t type; };
+template<bool Fits8>
+struct MAX6921_SegmentMaskSelect<Fits8, true, true> { typedef uint16_t type; };
+template<>
+struct MAX6921_SegmentMaskSelect<true, true, true> { typedef uint8_t type; };
+
+template<uint8_t Segments>
+struct MAX6921_SegmentMask {
+    static_assert(Segments > 0 && Segments <= 64, "segment count must be 1-64");
+
+    typedef typename MAX6921_SegmentMaskSelect<(Segments <= 8), (Segments <= 16), (Segments <= 32)>::type type;
+
+    // 사용하는 세그먼트 비트만 1 (형 크기와 같은 시프트를 피하기 위해 위에서 잘라냄)
+    static const type all = (type)(~(type)0 >> (sizeof(type) * 8 - Segments));
+};
+
+template<uint8_t Grids, uint8_t Segments>
+class MAX6921_GridStore {
+public:
+    typedef typename MAX6921_SegmentMask<Segments>::type Mask;
+
+    static const uint8_t numGrids = Grids;
+    static const uint8_t numSegments = Segments;
+    static const Mask allSegments = MAX6921_SegmentMask<Segments>::all;
+
+private:
+    Mask _data[Grids];
+
+public:
+    MAX6921_GridStore() { clear(); }
+
+    void clear() {
+        memset(_data, 0, sizeof(_data));
+    }
+
+    Mask get(uint8_t grid) const {
+        return (grid < Grids) ? _data[grid] : 0;
+    }
+
+    // 값이 바뀌었으면 true (범위 밖 그리드와 세그먼트 비트는 무시)
+    bool set(uint8_t grid, Mask mask) {
+        if (grid >= Grids) return false;
+        mask &= allSegments;
+        if (_data[grid] == mask) return false;
+        _data[grid] = mask;
+        return true;
+    }
+
+    bool setSegment(uint8_t grid, uint8_t segment, bool state) {
+        if (grid >= Grids || segment >= Segments) return false;
+        Mask bit = (Mask)((Mask)1 << segment);
+        return set(grid, state ? (Mask)(_data[grid] | bit) : (Mask)(_data[grid] & ~bit));
+    }
+};
+
+#endif // MAX6921_GRID_STORE_H
@@ -0,0 +1,278 @@
+/*
+ * MAX6921_SerialProtocol.cpp
+ *
+ * Implementation file for streaming serial display protocol
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_SerialProtocol.h"
+
+MAX6921_SerialProtocol::MAX6921_SerialProtocol(MAX6921_VFD_Driver* driver) {
+    _driver = driver;
+    _marqueeText[0] = '\0';
+    _marqueeId = -1;
+    _ack = true;
+    _lineMode = true;
+    reset();
+    resetStats();
+}
+
+bool MAX6921_SerialProtocol::write(uint8_t byte) {
+    uint8_t next = (uint8_t)((_head + 1) & (MAX6921_PROTO_RING_SIZE - 1));
+    if (next == _tail) {
+        _overflowCount++;
+        return false;
+    }
+    _ring[_head] = byte;
+    _head = next;
+    return true;
+}
+
+void MAX6921_SerialProtocol::process(Print* reply) {
+    // 프레임 도중 호스트가 끊기면 다음 프레임의 0xA5를 payload로 삼키지 않도록 버림
+    // (받아 둔 바이트가 남아 있으면 loop()가 늦은 것이므로 타임아웃으로 보지 않음)
+    if (_tail == _head && _state != STATE_SYNC && millis() - _lastByteMs > MAX6921_PROTO_FRAME_TIMEOUT_MS) {
+        _state = STATE_SYNC;
+        _index = 0;
+        _errorCount++;
+    }
+
+    while (_tail != _head) {
+        uint8_t byte = _ring[_tail];
+        _tail = (uint8_t)((_tail + 1) & (MAX6921_PROTO_RING_SIZE - 1));
+        parse(byte, reply);
+    }
+}
+
+// UART 수신 버퍼(64바이트)를 빨리 비우도록 읽을 수 있는 만큼 옮긴 뒤 해석
+void MAX6921_SerialProtocol::poll(Stream& stream) {
+    while (stream.available() > 0) {
+        if (!write((uint8_t)stream.read())) break;
+    }
+    process(&stream);
+}
+
+void MAX6921_SerialProtocol::reset() {
+    _head = 0;
+    _tail = 0;
+    _state = STATE_SYNC;
+    _index = 0;
+}
+
+void MAX6921_SerialProtocol::setAck(bool enable) {
+    _ack = enable;
+}
+
+void MAX6921_SerialProtocol::setLineMode(bool enable) {
+    _lineMode = enable;
+    _index = 0;
+}
+
+uint32_t MAX6921_SerialProtocol::getFrameCount() {
+    return _frameCount;
+}
+
+uint32_t MAX6921_SerialProtocol::getErrorCount() {
+    return _errorCount;
+}
+
+uint32_t MAX6921_SerialProtocol::getOverflowCount() {
+    return _overflowCount;
+}
+
+void MAX6921_SerialProtocol::resetStats() {
+    _frameCount = 0;
+    _errorCount = 0;
+    _overflowCount = 0;
+}
+
+uint8_t MAX6921_SerialProtocol::crc8(uint8_t crc, uint8_t byte) {
+    crc ^= byte;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+// 바이트 1개 해석 (프레임이 완성되면 명령 실행 + 응답)
+void MAX6921_SerialProtocol::parse(uint8_t byte, Print* reply) {
+    if (_state != STATE_SYNC) _lastByteMs = millis();
+
+    switch (_state) {
+    case STATE_SYNC:
+        if (byte == MAX6921_PROTO_SYNC) {
+            _state = STATE_COMMAND;
+            _index = 0;                   // 입력 중이던 텍스트 줄은 버림
+            _crc = 0;
+            _lastByteMs = millis();
+        } else if (_lineMode) {
+            lineByte(byte);
+        }
+        break;
+
+    case STATE_COMMAND:
+        _command = byte;
+        _crc = crc8(_crc, byte);
+        _state = STATE_LENGTH;
+        break;
+
+    case STATE_LENGTH:
+        if (byte > MAX6921_PROTO_MAX_PAYLOAD) {
+            _errorCount++;
+            _state = STATE_SYNC;
+            break;
+        }
+        _length = byte;
+        _crc = crc8(_crc, byte);
+        _state = (byte == 0) ? STATE_CRC : STATE_PAYLOAD;
+        break;
+
+    case STATE_PAYLOAD:
+        _payload[_index++] = (char)byte;
+        _crc = crc8(_crc, byte);
+        if (_index == _length) _state = STATE_CRC;
+        break;
+
+    case STATE_CRC:
+        _state = STATE_SYNC;
+        _index = 0;
+        if (byte != _crc) {
+            _errorCount++;
+            sendReply(reply, MAX6921_PROTO_CRC_ERROR_CMD, MAX6921_STATUS_CRC_ERROR);
+            break;
+        }
+        _frameCount++;
+        sendReply(reply, MAX6921_PROTO_REPLY | _command, dispatch());
+        break;
+    }
+}
+
+// 프레임 밖 텍스트: 인쇄 가능 문자를 모았다가 줄 끝에서 표시 (빈 줄은 무시)
+void MAX6921_SerialProtocol::lineByte(uint8_t byte) {
+    if (byte == '\r' || byte == '\n') {
+        if (_index == 0) return;
+        _payload[_index] = '\0';
+        _index = 0;
+        _driver->displayString(_payload);
+    } else if (byte >= 0x20 && byte < 0x7F && _index < MAX6921_PROTO_MAX_PAYLOAD) {
+        _payload[_index++] = (char)byte;
+    }
+}
+
+uint8_t MAX6921_SerialProtocol::dispatch() {
+    switch (_command) {
+    case MAX6921_CMD_TEXT:
+        _payload[_length] = '\0';
+        _driver->displayString(_payload);
+        return MAX6921_STATUS_OK;
+
+    case MAX6921_CMD_GRIDS:
+        return handleGrids();
+
+    case MAX6921_CMD_BRIGHTNESS:
+        return handleBrightness();
+
+    case MAX6921_CMD_EFFECT:
+        return handleEffect();
+
+    case MAX6921_CMD_PING:
+        return MAX6921_STATUS_OK;
+    }
+    return MAX6921_STATUS_UNKNOWN_COMMAND;
+}
+
+// first | 마스크 x N (리틀 엔디언), 모든 그리드를 back 버퍼에 쓴 뒤 한 번만 present()
+uint8_t MAX6921_SerialProtocol::handleGrids() {
+    if (_length < 1 || (_length - 1) % MAX6921_PROTO_GRID_BYTES != 0) return MAX6921_STATUS_BAD_LENGTH;
+
+    uint8_t first = (uint8_t)_payload[0];
+    uint8_t count = (uint8_t)((_length - 1) / MAX6921_PROTO_GRID_BYTES);
+    uint8_t numGrids = _driver->getNumGrids();
+    if (first >= numGrids || count > numGrids - first) return MAX6921_STATUS_BAD_ARGUMENT;
+
+    VFD_SegmentMask masks[VFD_MAX_GRIDS];
+    const uint8_t* data = (const uint8_t*)&_payload[1];
+    for (uint8_t i = 0; i < count; i++) {
+        VFD_SegmentMask mask = 0;
+        for (uint8_t b = MAX6921_PROTO_GRID_BYTES; b > 0; b--) {
+            mask = (VFD_SegmentMask)((mask << 8) | data[b - 1]);
+        }
+        masks[i] = mask;
+        data += MAX6921_PROTO_GRID_BYTES;
+    }
+    _driver->setGrids(first, masks, count);
+    return MAX6921_STATUS_OK;
+}
+
+uint8_t MAX6921_SerialProtocol::handleBrightness() {
+    if (_length == 1) {
+        _driver->setBrightness((uint8_t)_payload[0]);
+    } else if (_length == 3) {
+        uint16_t fadeMs = (uint16_t)((uint8_t)_payload[1] | ((uint8_t)_payload[2] << 8));
+        _driver->fadeTo((uint8_t)_payload[0], fadeMs);
+    } else {
+        return MAX6921_STATUS_BAD_LENGTH;
+    }
+    return MAX6921_STATUS_OK;
+}
+
+// type | first | count | intervalMs(LE16) | arg [| text]
+uint8_t MAX6921_SerialProtocol::handleEffect() {
+    if (_length < 1) return MAX6921_STATUS_BAD_LENGTH;
+
+    MAX6921_EffectEngine& effects = _driver->effects();
+    uint8_t type = (uint8_t)_payload[0];
+
+    if (type == MAX6921_EFFECT_NONE) {
+        effects.stopAll();
+        _marqueeId = -1;
+        return MAX6921_STATUS_OK;
+    }
+    if (_length < 6) return MAX6921_STATUS_BAD_LENGTH;
+
+    uint8_t first = (uint8_t)_payload[1];
+    uint8_t count = (uint8_t)_payload[2];
+    uint16_t intervalMs = (uint16_t)((uint8_t)_payload[3] | ((uint8_t)_payload[4] << 8));
+    uint8_t arg = (uint8_t)_payload[5];
+    char* text = &_payload[6];
+    _payload[_length] = '\0';
+
+    int8_t id;
+    switch (type) {
+    case MAX6921_EFFECT_MARQUEE:
+        // 마퀴는 문자열을 복사하지 않으므로 프로토콜 버퍼에 보관 (이전 프로토콜 마퀴는 중지)
+        // 이전 마퀴가 이미 끝났으면 그 번호를 다른 효과가 쓰고 있을 수 있으므로 문자열로 확인
+        if (effects.getMarqueeText(_marqueeId) == _marqueeText) effects.stop(_marqueeId);
+        strcpy(_marqueeText, text);
+        id = effects.marquee(_marqueeText, first, count, intervalMs, arg != 0);
+        _marqueeId = id;
+        break;
+    case MAX6921_EFFECT_BLINK:
+        id = effects.blink(first, count, intervalMs, arg);
+        break;
+    case MAX6921_EFFECT_WIPE:
+        id = effects.wipe(text, first, count, intervalMs);
+        break;
+    case MAX6921_EFFECT_CROSSFADE:
+        id = effects.crossfade(text, first, count, intervalMs);
+        break;
+    default:
+        return MAX6921_STATUS_UNKNOWN_COMMAND;
+    }
+    return (id < 0) ? MAX6921_STATUS_BAD_ARGUMENT : MAX6921_STATUS_OK;
+}
+
+void MAX6921_SerialProtocol::sendReply(Print* reply, uint8_t command, uint8_t status) {
+    if (!_ack || reply == NULL) return;
+
+    uint8_t frame[5];
+    frame[0] = MAX6921_PROTO_SYNC;
+    frame[1] = command;
+    frame[2] = 1;
+    frame[3] = status;
+    frame[4] = crc8(crc8(crc8(0, command), 1), status);
+    reply->write(frame, sizeof(frame));
+}
@@ -0,0 +1,156 @@
+/*
+ * MAX6921_SerialProtocol.h
+ *
+ * 호스트 PC → VFD 스트리밍 시리얼 프로토콜 (바이너리 프레임)
+ *
+ * Serial.readString()은 스트림 타임아웃(기본 1초)만큼 블로킹하고 String을 할당하므로
+ * 초당 여러 번 갱신하는 호스트에는 맞지 않는다. 이 파서는 수신 바이트를 고정 크기
+ * 링 버퍼에 넣고 한 바이트씩 상태 기계로 해석한다 (동적 할당 없음, 블로킹 없음).
+ *
+ * ===== 프레임 형식 =====
+ *
+ *   0xA5 | CMD | LEN | PAYLOAD[LEN] | CRC8
+ *
+ *   - CRC8: 다항식 0x07, 초기값 0, CMD + LEN + PAYLOAD에 대해 계산
+ *   - LEN 최대 MAX6921_PROTO_MAX_PAYLOAD, 넘으면 프레임을 버리고 다음 0xA5를 찾음
+ *   - 프레임 도중 MAX6921_PROTO_FRAME_TIMEOUT_MS 동안 다음 바이트가 없으면 버림
+ *
+ * ===== 명령 =====
+ *
+ *   0x01 TEXT        문자열 (displayString, 남는 자리는 공백)
+ *   0x02 GRIDS       first | 그리드별 세그먼트 마스크 (MAX6921_PROTO_GRID_BYTES바이트, 리틀 엔디언)
+ *                    여러 그리드를 모두 쓴 뒤 한 번에 present()
+ *   0x03 BRIGHTNESS  level [| fadeMs(LE16)]  fadeMs가 있으면 fadeTo()
+ *   0x04 EFFECT      type | first | count | intervalMs(LE16) | arg [| text]
+ *                    type = MAX6921_EffectType (0 = 모든 효과 중지)
+ *                    arg  = marquee: 반복 여부, blink: 횟수 (0 = 무한)
+ *   0x05 PING        임의 payload (응답만 보냄, 지연 측정용)
+ *
+ * ===== 응답 =====
+ *
+ *   0xA5 | 0x80|CMD | 1 | status | CRC8      (setAck(false)로 끌 수 있음)
+ *
+ *   CRC 오류 프레임은 CMD를 믿을 수 없으므로 CMD = 0x7F, status = CRC 오류로 응답
+ *   응답은 명령을 드라이버에 반영한 뒤 보내므로 호스트에서 잰 왕복 시간이 갱신 지연이 됨
+ *
+ * ===== 텍스트 줄 모드 =====
+ *
+ *   프레임 밖에서 받은 인쇄 가능 문자는 줄로 모았다가 '\r' 또는 '\n'에서 TEXT로 표시
+ *   (시리얼 모니터에서 직접 입력 가능, 0xA5는 ASCII가 아니므로 프레임과 겹치지 않음)
+ *
+ *   MAX6921_SerialProtocol proto(&vfd);
+ *   loop() { proto.poll(Serial); vfd.refresh(); }
+ *
+ * 호스트 쪽 기준 인코더와 지연/처리량 측정: tools/vfd_serial.py
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_SERIAL_PROTOCOL_H
+#define MAX6921_SERIAL_PROTOCOL_H
+
+#include <Arduino.h>
+#include "MAX6921_VFD_Driver.h"
+
+#define MAX6921_PROTO_SYNC              0xA5
+#define MAX6921_PROTO_REPLY             0x80  // 응답 CMD = 0x80 | 요청 CMD
+#define MAX6921_PROTO_CRC_ERROR_CMD     0x7F
+#define MAX6921_PROTO_MAX_PAYLOAD       64
+#define MAX6921_PROTO_RING_SIZE         128   // 2의 거듭제곱 (인덱스 마스킹)
+#define MAX6921_PROTO_FRAME_TIMEOUT_MS  50
+#define MAX6921_PROTO_GRID_BYTES        ((VFD_MAX_SEGMENTS + 7) / 8)  // 저장소 용량 기준 (7BT317NK 설정: 3바이트)
+
+static_assert((MAX6921_PROTO_RING_SIZE & (MAX6921_PROTO_RING_SIZE - 1)) == 0 && MAX6921_PROTO_RING_SIZE <= 256,
+              "ring size must be a power of two up to 256");
+static_assert(MAX6921_PROTO_GRID_BYTES <= 4, "grid bitmap command supports up to 32 segments");
+
+enum MAX6921_ProtoCommand {
+    MAX6921_CMD_TEXT = 0x01,
+    MAX6921_CMD_GRIDS = 0x02,
+    MAX6921_CMD_BRIGHTNESS = 0x03,
+    MAX6921_CMD_EFFECT = 0x04,
+    MAX6921_CMD_PING = 0x05
+};
+
+enum MAX6921_ProtoStatus {
+    MAX6921_STATUS_OK = 0,
+    MAX6921_STATUS_BAD_LENGTH,            // payload 길이가 명령과 맞지 않음
+    MAX6921_STATUS_BAD_ARGUMENT,          // 범위 밖 그리드, 효과 슬롯 부족 등
+    MAX6921_STATUS_UNKNOWN_COMMAND,
+    MAX6921_STATUS_CRC_ERROR
+};
+
+class MAX6921_SerialProtocol {
+private:
+    enum State {
+        STATE_SYNC = 0,                   // 0xA5 대기 (텍스트 줄 모드 입력 포함)
+        STATE_COMMAND,
+        STATE_LENGTH,
+        STATE_PAYLOAD,
+        STATE_CRC
+    };
+
+    MAX6921_VFD_Driver* _driver;
+
+    // 수신 링 버퍼 (write()는 ISR에서, process()는 loop()에서 호출 가능: 생산자/소비자 1개씩)
+    uint8_t _ring[MAX6921_PROTO_RING_SIZE];
+    volatile uint8_t _head;
+    volatile uint8_t _tail;
+
+    // 프레임 상태
+    uint8_t _state;
+    uint8_t _command;
+    uint8_t _length;
+    uint8_t _index;
+    uint8_t _crc;
+    unsigned long _lastByteMs;            // 프레임 안에서 마지막으로 해석한 바이트 시각
+    char _payload[MAX6921_PROTO_MAX_PAYLOAD + 1];  // +1: TEXT 종료 문자
+
+    // 프로토콜로 시작한 마퀴 문자열 (효과가 끝날 때까지 유지되어야 하므로 복사해 둠)
+    char _marqueeText[MAX6921_PROTO_MAX_PAYLOAD + 1];
+    int8_t _marqueeId;                    // 마지막 프로토콜 마퀴 번호 (끝난 뒤에는 다른 효과가 쓸 수 있음)
+
+    bool _ack;
+    bool _lineMode;
+
+    // 통계
+    uint32_t _frameCount;
+    uint32_t _errorCount;                 // CRC 오류, 길이 초과, 타임아웃
+    uint32_t _overflowCount;              // 링 버퍼가 가득 차서 버린 바이트
+
+    void parse(uint8_t byte, Print* reply);
+    void lineByte(uint8_t byte);
+    uint8_t dispatch();
+    uint8_t handleGrids();
+    uint8_t handleBrightness();
+    uint8_t handleEffect();
+    void sendReply(Print* reply, uint8_t command, uint8_t status);
+
+public:
+    MAX6921_SerialProtocol(MAX6921_VFD_Driver* driver);
+
+    // 수신 바이트 1개 추가 (가득 차면 false, 바이트는 버려짐)
+    bool write(uint8_t byte);
+
+    // 링 버퍼의 바이트를 모두 해석 (응답은 reply로, NULL이면 응답 없음)
+    void process(Print* reply = NULL);
+
+    // stream에서 읽을 수 있는 만큼 링 버퍼로 옮긴 뒤 process(&stream)
+    void poll(Stream& stream);
+
+    void reset();                         // 진행 중인 프레임과 링 버퍼 비우기
+    void setAck(bool enable);             // 기본 true
+    void setLineMode(bool enable);        // 기본 true: 프레임 밖 텍스트 줄 표시
+
+    uint32_t getFrameCount();
+    uint32_t getErrorCount();
+    uint32_t getOverflowCount();
+    void resetStats();
+
+    // CRC8 (다항식 0x07) 1바이트 갱신
+    static uint8_t crc8(uint8_t crc, uint8_t byte);
+};
+
+#endif // MAX6921_SERIAL_PROTOCOL_H
@@ -0,0 +1,197 @@
+/*
+ * MAX6921_Simulator.h
+ *
+ * 가상 MAX6921 체인 + VFD 유리(glass) 시뮬레이터
+ *
+ * 보드 없이 드라이버의 스캔 동작을 확인하기 위한 모델.
+ * MAX6921_Transport로 드라이버에 연결하면 전송되는 비트 스트림을 그대로
+ * 가상 시프트 레지스터에 넣고, 시간 경과에 따라 세그먼트별 점등 시간을 누적한다.
+ *
+ * ===== 모델 (MAX6921 데이터시트 기준) =====
+ *
+ * - CLK 상승 에지: 시프트 레지스터가 한 칸 이동, DIN이 칩 #1 OUT0 자리로 입력
+ *   (체인 끝 칩의 OUT19에서 밀려난 비트는 DOUT으로 나가 버려짐)
+ * - LOAD HIGH: 출력 래치가 시프트 레지스터를 그대로 따라감 (transparent)
+ *   LOAD 하강 에지에서 래치 고정, LOW 동안 유지
+ * - BLANK HIGH: 래치 내용과 관계없이 모든 출력 OFF
+ *
+ * VFD 셀 (그리드 g, 세그먼트 s)은 두 출력이 모두 HIGH인 동안 점등된 것으로 본다.
+ *
+ * ===== 고스팅 모델 =====
+ *
+ * 실제 출력은 꺼질 때 바로 0V가 되지 않는다 (MAX6921 출력 하강 + 그리드/애노드 전극 용량).
+ * VFD_SimGlass::setOutputDecay(us)를 지정하면 꺼진 전극이 그 시간 동안 계속 켜진 것으로 본다.
+ * 잔류 전극 때문에 켜진 셀 중 그 그리드가 마지막으로 구동될 때 켜져 있지 않던 셀의 시간을
+ * 셀별 고스트 시간으로 따로 누적한다 (getGhostTime). 원래 켜져 있던 셀의 잔광은 고스트가 아니다.
+ * 잔류 구간도 완전 점등으로 계산하므로 고스트 에너지의 상한값이다.
+ * 예: BLANK 없이 LOAD만 바꾸거나 BLANK 직후 바로 해제하면 이전 그리드가 새 세그먼트로,
+ * 새 그리드가 이전 세그먼트로 잠깐 켜진다. lead 가드(setBlankGuard)가 잔류 시간 이상이면 0.
+ *
+ * ===== 사용법 (호스트 빌드) =====
+ *
+ *   VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS,
+ *                      VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+ *   (다른 튜브 프로필이면 프로필의 gridChainBit/numGrids/segmentChainBit/numSegments 사용)
+ *   MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+ *   vfd.setTransport(&sim);
+ *   ...
+ *   sim.advance(us);   // 시뮬레이션 시간 진행 (micros()도 sim.getTimeUs()를 반환하도록 구성)
+ *
+ * 호스트 빌드(Arduino shim, micros() 연결)와 테스트는 tests/host/ 참조.
+ *
+ * BLANK는 MAX6921_Transport::blank() 통지로 전달되므로 소프트웨어 BLANK 경로만 모델링된다.
+ *
+ * setClockSpeed(hz)를 지정하면 비동기 전송(MAX6921_AsyncSPITransport)처럼 동작한다:
+ * send()는 LOAD만 내리고 반환하며, advance()로 시간이 흐르는 만큼 비트가 클록되고
+ * 마지막 비트 뒤에 LOAD를 올린 다음 완료 콜백을 호출한다.
+ * 체인 비트 수보다 적게 클록된 상태에서 LOAD가 올라가면 getShortLatchCount()로,
+ * 시프트 중에 BLANK가 해제되면 getBlankReleaseDuringShiftCount()로 확인할 수 있다.
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_SIMULATOR_H
+#define MAX6921_SIMULATOR_H
+
+#include <Arduino.h>
+#include "MAX6921_Transport.h"
+
+// 시뮬레이터 최대 규모
+#define MAX6921_SIM_MAX_CHIPS     4
+#define MAX6921_SIM_MAX_BITS      (MAX6921_SIM_MAX_CHIPS * MAX6921_OUTPUT_BITS)
+#define MAX6921_SIM_WORDS         ((MAX6921_SIM_MAX_BITS + 31) / 32)
+#define VFD_SIM_MAX_GRIDS         16
+#define VFD_SIM_MAX_SEGMENTS      32
+
+// 가상 MAX6921 데이지 체인 (시프트 레지스터 + 출력 래치 + BLANK)
+class MAX6921_SimChain {
+private:
+    uint8_t _numChips;
+    uint32_t _shift[MAX6921_SIM_WORDS];   // 시프트 레지스터 (bit k = 체인 비트 k)
+    uint32_t _latch[MAX6921_SIM_WORDS];   // 출력 래치
+    bool _load;
+    bool _blank;
+
+    // 통계
+    uint32_t _clockCount;
+    uint32_t _latchCount;                 // LOAD 상승 에지 수
+    uint32_t _transparentClocks;          // LOAD HIGH 상태에서 들어온 클록 (출력 글리치)
+    uint16_t _loadLowClocks;              // 마지막 LOAD 하강 이후 클록 수
+    uint32_t _shortLatches;               // 체인 전체가 시프트되기 전에 올라간 LOAD 수
+
+public:
+    MAX6921_SimChain(uint8_t numChips);
+
+    void reset();
+
+    // 핀 레벨 입력
+    void clock(bool din);                 // CLK 상승 에지 1회
+    void setLoad(bool level);
+    void setBlank(bool level);
+
+    // 상태 확인
+    bool getOutput(uint8_t bit) const;    // 실제 출력 (BLANK 반영)
+    bool getLatch(uint8_t bit) const;     // 래치 값
+    bool isBlanked() const;
+    uint8_t getNumChips() const;
+    uint8_t getNumBits() const;
+
+    uint32_t getClockCount() const;
+    uint32_t getLatchCount() const;
+    uint32_t getTransparentClockCount() const;
+    uint32_t getShortLatchCount() const;
+};
+
+// 가상 VFD 유리: 셀별 점등 시간 누적
+// 체인 비트 테이블은 생성된 출력 맵(PROGMEM)을 그대로 사용
+class VFD_SimGlass {
+private:
+    const uint8_t* _gridChainBits;        // PROGMEM: 그리드 Gn → 체인 비트
+    const uint8_t* _segmentChainBits;     // PROGMEM: 세그먼트 Pn → 체인 비트
+    uint8_t _numGrids;
+    uint8_t _numSegments;
+
+    uint32_t _segmentOnTime[VFD_SIM_MAX_GRIDS][VFD_SIM_MAX_SEGMENTS];
+    uint32_t _ghostTime[VFD_SIM_MAX_GRIDS][VFD_SIM_MAX_SEGMENTS];  // 잔류 출력에 의한 점등 시간
+    uint32_t _gridOnTime[VFD_SIM_MAX_GRIDS];
+    uint32_t _overlapTime;                // 그리드 2개 이상이 동시에 켜진 시간
+    uint32_t _elapsedTime;
+
+    // 출력 잔류 모델 (전극별 구동 상태 + 꺼진 뒤 남은 잔류 시간)
+    uint16_t _outputDecayUs;
+    bool _gridDriven[VFD_SIM_MAX_GRIDS];
+    bool _segmentDriven[VFD_SIM_MAX_SEGMENTS];
+    uint16_t _gridTail[VFD_SIM_MAX_GRIDS];
+    uint16_t _segmentTail[VFD_SIM_MAX_SEGMENTS];
+    uint32_t _gridPattern[VFD_SIM_MAX_GRIDS];  // 그리드가 마지막으로 구동될 때 켜진 세그먼트
+
+    void accumulateSpan(uint32_t us);
+
+public:
+    VFD_SimGlass(const uint8_t* gridChainBits, uint8_t numGrids,
+                 const uint8_t* segmentChainBits, uint8_t numSegments);
+
+    void reset();
+
+    // 꺼진 출력이 남아 있는 시간 (0 = 이상적인 출력, 기본값)
+    void setOutputDecay(uint16_t us);
+    uint16_t getOutputDecay() const;
+
+    // 현재 체인 출력 상태로 us 동안 점등 시간 누적
+    void accumulate(const MAX6921_SimChain& chain, uint32_t us);
+
+    uint32_t getSegmentOnTime(uint8_t grid, uint8_t segment) const;
+    uint32_t getGhostTime(uint8_t grid, uint8_t segment) const;
+    uint32_t getTotalGhostTime() const;   // 모든 셀의 고스트 시간 합
+    uint32_t getGridOnTime(uint8_t grid) const;
+    uint32_t getOverlapTime() const;
+    uint32_t getElapsedTime() const;
+
+    // 점유율 (0-65535 = 0-100%)
+    uint16_t getSegmentDuty(uint8_t grid, uint8_t segment) const;
+
+    uint8_t getNumGrids() const;
+    uint8_t getNumSegments() const;
+};
+
+// 드라이버 전송 계층 → 가상 체인
+class MAX6921_SimTransport : public MAX6921_Transport {
+private:
+    MAX6921_SimChain _chain;
+    VFD_SimGlass* _glass;                 // NULL이면 점등 시간 누적 안 함
+    uint32_t _timeUs;                     // 시뮬레이션 시간
+    uint32_t _frameCount;
+
+    // 비동기 전송 모델 (_clockHz == 0이면 send() 안에서 즉시 전송)
+    uint32_t _clockHz;
+    uint8_t _pending[MAX6921_ASYNC_MAX_BYTES];
+    uint8_t _pendingBits;                 // 전송할 비트 수
+    uint8_t _shiftedBits;                 // 이미 클록된 비트 수
+    uint32_t _clockRemainder;             // 1us 미만 클록 누적 (Hz 단위)
+    uint32_t _blankReleasesDuringShift;
+
+    void shiftPending(uint8_t bits);
+
+public:
+    MAX6921_SimTransport(uint8_t numChips, VFD_SimGlass* glass = NULL);
+
+    virtual void begin();
+    virtual void send(const uint8_t* frame, uint8_t length);
+    virtual bool isBusy();
+    virtual void blank(bool blanked);
+
+    // 비동기 전송 클록 (0 = 동기 전송, 기본값)
+    void setClockSpeed(uint32_t clockHz);
+    uint32_t getBlankReleaseDuringShiftCount() const;
+
+    // 시뮬레이션 시간 진행 (현재 출력 상태가 us 동안 유지된 것으로 누적)
+    void advance(uint32_t us);
+
+    uint32_t getTimeUs() const;
+    uint32_t getFrameCount() const;
+    MAX6921_SimChain& getChain();
+};
+
+#endif // MAX6921_SIMULATOR_H
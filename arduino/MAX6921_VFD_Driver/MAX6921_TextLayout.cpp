@@ -0,0 +1,89 @@
+/*
+ * MAX6921_TextLayout.cpp
+ *
+ * Implementation file for text to grid cell layout
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_TextLayout.h"
+
+uint16_t max6921DecodeUtf8(const char*& text) {
+    uint8_t lead = (uint8_t)*text++;
+    if (lead < 0x80) return lead;
+
+    uint8_t extra;
+    uint16_t codePoint;
+    if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        codePoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        codePoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        codePoint = 0;
+    } else {
+        return lead;                      // 단독 연속 바이트 등: Latin-1
+    }
+
+    // 연속 바이트 확인 (문자열 끝의 '\0'에서 멈춤)
+    for (uint8_t i = 0; i < extra; i++) {
+        if (((uint8_t)text[i] & 0xC0) != 0x80) return lead;
+    }
+    for (uint8_t i = 0; i < extra; i++) {
+        codePoint = (uint16_t)((codePoint << 6) | ((uint8_t)text[i] & 0x3F));
+    }
+    text += extra;
+    return (extra == 3) ? MAX6921_GLYPH_INVALID : codePoint;
+}
+
+uint8_t max6921LayoutText(const char* text, MAX6921_TextCell* cells, uint8_t count,
+                          uint16_t dpGrids, uint16_t colonGrids,
+                          const MAX6921_GlyphCache* glyphs) {
+    uint8_t used = 0;
+
+    while (*text != '\0') {
+        uint16_t codePoint = max6921DecodeUtf8(text);
+        char ch = glyphs ? (char)glyphs->cellCode(codePoint)
+                         : (codePoint < 0x80) ? (char)codePoint : (char)MAX6921_GLYPH_UNKNOWN;
+        uint8_t mark = 0;
+        uint16_t supported = 0;
+
+        if (ch == '.') {
+            mark = MAX6921_MARK_DP;
+            supported = dpGrids;
+        } else if (ch == ':') {
+            mark = MAX6921_MARK_COLON;
+            supported = colonGrids;
+        }
+
+        // 앞 자리에 합치기 (자리를 차지하지 않음)
+        if (mark != 0 && used > 0) {
+            MAX6921_TextCell& previous = cells[used - 1];
+            if (((supported >> (used - 1)) & 1) && !(previous.marks & mark)) {
+                previous.marks |= mark;
+                continue;
+            }
+        }
+
+        if (used == count) break;
+
+        MAX6921_TextCell& cell = cells[used++];
+        if (mark != 0 && ((supported >> (used - 1)) & 1)) {
+            cell.character = ' ';
+            cell.marks = mark;
+        } else {
+            cell.character = ch;
+            cell.marks = 0;
+        }
+    }
+
+    for (uint8_t i = used; i < count; i++) {
+        cells[i].character = ' ';
+        cells[i].marks = 0;
+    }
+    return used;
+}
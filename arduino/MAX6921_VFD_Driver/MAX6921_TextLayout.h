@@ -0,0 +1,59 @@
+/*
+ * MAX6921_TextLayout.h
+ *
+ * 문자열 → 자리(그리드)별 문자 + 구두점 배치
+ *
+ * '.'과 ':'은 자리를 차지하지 않고 바로 앞 자리의 소수점/콜론 세그먼트(애넌시에이터)로
+ * 합쳐진다. 어느 그리드에 소수점/콜론이 있는지는 튜브 설정(VFD_DP_GRIDS, VFD_COLON_GRIDS)이 정한다.
+ *
+ *   "12:34.5"  →  [1][2:][3][4.][5][ ][ ]
+ *
+ * 합칠 수 없는 구두점은 자기 자리를 차지한다
+ *   - 문자열 맨 앞 (앞 자리 없음)
+ *   - 앞 자리에 같은 표시가 이미 있음 ("1..2"의 두 번째 '.')
+ *   - 앞 자리 그리드에 해당 애넌시에이터가 없음
+ * 이때 그 자리에 애넌시에이터가 있으면 빈 칸 + 표시, 없으면 폰트의 '.'/':' 문자로 둔다.
+ *
+ * 자리가 다 찬 뒤에도 마지막 자리에 합칠 수 있는 구두점은 합친다 ("1234567." → 7번째 자리 소수점).
+ *
+ * 문자열은 UTF-8로 읽으며 문자 1개(여러 바이트)가 자리 1개를 차지한다. 자리 문자는 글리프 캐시의
+ * cellCode()로 정해진다 (등록된 글리프 = 슬롯 코드, ASCII = 그대로, 그 밖 = MAX6921_GLYPH_UNKNOWN).
+ * UTF-8로 해석되지 않는 바이트("\xB0")는 그 바이트 값의 Latin-1 문자로 본다.
+ * 한 번의 순회로 끝나며, 자리마다 문자 1개 + 표시 2개까지만 받으므로
+ * 긴 문자열도 (자리 수 x 3 + 1)글자 이내에서 멈춘다. snprintf와 동적 할당 없음.
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_TEXT_LAYOUT_H
+#define MAX6921_TEXT_LAYOUT_H
+
+#include <Arduino.h>
+#include "MAX6921_GlyphCache.h"
+
+#define VFD_NO_SEGMENT          0xFF  // 튜브 설정에서 애넌시에이터가 없음을 표시
+
+// 자리별 구두점 표시
+#define MAX6921_MARK_DP         0x01
+#define MAX6921_MARK_COLON      0x02
+
+struct MAX6921_TextCell {
+    char character;                       // 자리 문자 코드 (ASCII 또는 사용자 글리프 슬롯 코드)
+    uint8_t marks;                        // MAX6921_MARK_DP | MAX6921_MARK_COLON
+};
+
+// text를 count개 자리에 배치 (남는 자리는 공백)
+// dpGrids/colonGrids: bit n = n번째 자리에 소수점/콜론 세그먼트가 있음
+// glyphs: 사용자 글리프 캐시 (NULL이면 ASCII 밖 문자는 모두 MAX6921_GLYPH_UNKNOWN)
+// 반환값: 문자열이 차지한 자리 수
+uint8_t max6921LayoutText(const char* text, MAX6921_TextCell* cells, uint8_t count,
+                          uint16_t dpGrids, uint16_t colonGrids,
+                          const MAX6921_GlyphCache* glyphs = NULL);
+
+// UTF-8 문자 1개 → 코드 포인트 (text는 다음 문자로 이동)
+// 잘못된 바이트열은 첫 바이트만 소비하여 Latin-1 문자로, BMP 밖 문자는 MAX6921_GLYPH_INVALID
+uint16_t max6921DecodeUtf8(const char*& text);
+
+#endif // MAX6921_TEXT_LAYOUT_H
@@ -0,0 +1,160 @@
+/*
+ * MAX6921_Transport.cpp
+ * 
+ * Implementation file for MAX6921 chain transport
+ * 
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_Transport.h"
+
+#if MAX6921_HAS_ASYNC_SPI
+#include <avr/interrupt.h>
+
+// SPI 전송 완료 인터럽트를 받을 전송 인스턴스 (SPI는 하나뿐)
+static MAX6921_AsyncSPITransport* _asyncSpiInstance = NULL;
+
+ISR(SPI_STC_vect) {
+    if (_asyncSpiInstance != NULL) {
+        _asyncSpiInstance->transferISR();
+    }
+}
+#endif
+
+// 칩별 20비트 워드를 체인 프레임으로 압축
+// 마지막 칩부터 20비트씩 비트 스트림에 이어 붙이며, 앞쪽 패딩 비트는 0
+void max6921PackChain(const uint32_t* chipWords, uint8_t numChips, uint8_t* out) {
+    uint8_t length = MAX6921_CHAIN_BYTES(numChips);
+    memset(out, 0, length);
+    
+    for (uint8_t chip = 0; chip < numChips; chip++) {
+        uint32_t word = chipWords[chip] & ((1UL << MAX6921_OUTPUT_BITS) - 1);
+        uint8_t base = chip * MAX6921_OUTPUT_BITS;
+        
+        for (uint8_t bit = 0; bit < MAX6921_OUTPUT_BITS; bit++) {
+            if (word & (1UL << bit)) {
+                max6921SetChainBit(out, length, base + bit);
+            }
+        }
+    }
+}
+
+MAX6921_SPITransport::MAX6921_SPITransport(uint8_t loadPin, uint32_t clockSpeed)
+    : _loadPin(loadPin) {
+    setClockSpeed(clockSpeed);
+}
+
+// SPI 클록 설정 (MAX6921 최대 클록으로 제한)
+void MAX6921_SPITransport::setClockSpeed(uint32_t clockSpeed) {
+    if (clockSpeed > MAX6921_MAX_SPI_CLOCK) clockSpeed = MAX6921_MAX_SPI_CLOCK;
+    _settings = SPISettings(clockSpeed, MSBFIRST, SPI_MODE0);
+}
+
+void MAX6921_SPITransport::begin() {
+    pinMode(_loadPin, OUTPUT);
+    digitalWrite(_loadPin, HIGH);     // 대기 HIGH: 래치 투명 (전송 중에만 LOW, 상승 에지에서 새 프레임 래치)
+    
+    SPI.begin();
+}
+
+// 프레임 전체를 LOAD 한 번 사이에 연속 전송
+void MAX6921_SPITransport::send(const uint8_t* frame, uint8_t length) {
+    SPI.beginTransaction(_settings);
+    
+    // Set LOAD pin low (common for all chips)
+    digitalWrite(_loadPin, LOW);
+    
+    for (uint8_t i = 0; i < length; i++) {
+        SPI.transfer(frame[i]);
+    }
+    
+    // Set LOAD pin high to latch data (common for all chips)
+    digitalWrite(_loadPin, HIGH);
+    
+    SPI.endTransaction();
+    notifyTransferComplete();
+}
+
+// ===========================================
+// MAX6921_AsyncSPITransport
+// ===========================================
+
+MAX6921_AsyncSPITransport::MAX6921_AsyncSPITransport(uint8_t loadPin, uint32_t clockSpeed)
+    : MAX6921_SPITransport(loadPin, clockSpeed), _length(0), _index(0), _busy(false) {
+}
+
+void MAX6921_AsyncSPITransport::begin() {
+    MAX6921_SPITransport::begin();
+#if MAX6921_HAS_ASYNC_SPI
+    _asyncSpiInstance = this;
+#endif
+}
+
+// 프레임을 복사한 뒤 첫 바이트만 시작하고 반환
+void MAX6921_AsyncSPITransport::send(const uint8_t* frame, uint8_t length) {
+#if MAX6921_HAS_ASYNC_SPI
+    if (length == 0) return;
+    if (length > MAX6921_ASYNC_MAX_BYTES) length = MAX6921_ASYNC_MAX_BYTES;
+    
+    waitIdle();
+    
+    memcpy(_buffer, frame, length);
+    _length = length;
+    _index = 1;
+    _busy = true;
+    
+    SPI.beginTransaction(_settings);
+    digitalWrite(_loadPin, LOW);
+    
+    uint8_t savedSREG = SREG;
+    cli();
+    (void)SPSR;                       // 이전 전송의 SPIF가 남아 있으면 지움
+    (void)SPDR;
+    SPCR |= _BV(SPIE);
+    SPDR = _buffer[0];
+    SREG = savedSREG;
+#else
+    MAX6921_SPITransport::send(frame, length);
+#endif
+}
+
+// 바이트 1개 전송 완료: 다음 바이트 전송, 마지막이면 LOAD를 올리고 완료 통지
+void MAX6921_AsyncSPITransport::transferISR() {
+#if MAX6921_HAS_ASYNC_SPI
+    if (!_busy) return;
+    
+    uint8_t index = _index;
+    if (index < _length) {
+        SPDR = _buffer[index];
+        _index = index + 1;
+        return;
+    }
+    
+    SPCR &= ~_BV(SPIE);
+    digitalWrite(_loadPin, HIGH);
+    SPI.endTransaction();
+    _busy = false;
+    notifyTransferComplete();
+#endif
+}
+
+bool MAX6921_AsyncSPITransport::isBusy() {
+    return _busy;
+}
+
+// 이전 프레임이 끝날 때까지 대기
+// 다른 ISR 안(인터럽트 꺼짐)에서도 끝나도록 SPIF를 직접 확인하여 진행시킴
+void MAX6921_AsyncSPITransport::waitIdle() {
+#if MAX6921_HAS_ASYNC_SPI
+    while (_busy) {
+        uint8_t savedSREG = SREG;
+        cli();
+        if (_busy && (SPSR & _BV(SPIF))) {
+            transferISR();
+        }
+        SREG = savedSREG;
+    }
+#endif
+}
@@ -0,0 +1,26 @@
+/*
+ * MAX6921_TubeProfile.cpp
+ *
+ * Implementation file for VFD tube profile lookup
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_TubeProfile.h"
+
+const MAX6921_TubeProfile* max6921FindTubeProfile(const MAX6921_TubeProfile* const* registry, uint8_t count, const char* name) {
+    if (registry == NULL || name == NULL) return NULL;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const MAX6921_TubeProfile* profile = (const MAX6921_TubeProfile*)pgm_read_ptr(&registry[i]);
+        const char* profileName = (const char*)pgm_read_ptr(&profile->name);
+        if (strcmp_P(name, profileName) == 0) return profile;
+    }
+    return NULL;
+}
+
+void max6921LoadTubeProfile(const MAX6921_TubeProfile* profile, MAX6921_TubeProfile* out) {
+    memcpy_P(out, profile, sizeof(MAX6921_TubeProfile));
+}
@@ -0,0 +1,87 @@
+/*
+ * MAX6921_TubeProfile.h
+ *
+ * VFD 튜브 프로필 (형상 + 체인 출력 맵 + 폰트 + 애넌시에이터)
+ *
+ * 한 펌웨어로 여러 튜브를 구동하기 위해 튜브별 설정을 플래시(PROGMEM)의 구조체 하나로 묶는다.
+ * 드라이버는 begin(&profile)에서 구조체를 RAM으로 한 번 복사해 두고(포인터와 숫자만, 약 30바이트),
+ * 테이블 자체는 플래시에 둔 채로 인코딩 시에만 읽는다. 스캔 핫패스는 미리 계산된
+ * 프레임만 전송하므로 프로필을 바꿔도 프레임당 비용은 그대로다.
+ *
+ *   튜브 파일 (VFD_<모델>_Font 폴더)
+ *     VFD_<모델>_Map.h      tools/gen_output_map.py로 생성한 체인 출력 맵
+ *     VFD_<모델>_Font.cpp   ASCII 0x20-0x7F 폰트 + 숫자 테이블 (패턴당 3바이트, max6921ReadPattern)
+ *     VFD_<모델>_Profile.h  위 테이블을 묶은 MAX6921_TubeProfile (VFD_<모델>_PROFILE)
+ *
+ *   const MAX6921_TubeProfile* const PROFILES[] PROGMEM = { &VFD_7BT317NK_PROFILE, &VFD_HLD812D_PROFILE };
+ *   vfd.begin(max6921FindTubeProfile(PROFILES, 2, "HLD812D"));
+ *
+ * 드라이버 저장소 크기는 컴파일 타임 용량(VFD_MAX_GRIDS/SEGMENTS/FRAME_BYTES)으로 정해지며,
+ * 용량보다 큰 프로필은 begin()에서 거부된다 (MAX6921_Config.h 참조).
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_TUBE_PROFILE_H
+#define MAX6921_TUBE_PROFILE_H
+
+#include <Arduino.h>
+
+#define MAX6921_TUBE_FONT_FIRST  0x20  // 프로필 폰트 테이블의 첫 문자
+#define MAX6921_TUBE_FONT_SIZE   96    // 0x20 ~ 0x7F
+
+// 폰트 패턴 저장 형식: 패턴 1개 = 3바이트 리틀엔디안 (세그먼트 P0-P23)
+// uint32_t 배열 대비 25% 작고, AVR은 정렬 제약이 없어 패딩도 없다.
+#define MAX6921_FONT_PATTERN_BYTES  3
+#define MAX6921_FONT_MAX_SEGMENTS   (MAX6921_FONT_PATTERN_BYTES * 8)
+
+// 패턴 상수 → 초기화 목록의 3바이트 (폰트 테이블 정의용)
+#define MAX6921_PACK_PATTERN(p)  (uint8_t)((uint32_t)(p) & 0xFF), \
+                                 (uint8_t)(((uint32_t)(p) >> 8) & 0xFF), \
+                                 (uint8_t)(((uint32_t)(p) >> 16) & 0xFF)
+
+// 플래시의 패킹된 패턴 테이블에서 index번째 패턴 읽기
+// (바이트 단위로 읽으므로 정렬되지 않은 주소에서도 모든 코어에서 안전)
+static inline uint32_t max6921ReadPattern(const uint8_t* table, uint8_t index) {
+    const uint8_t* p = table + (uint16_t)index * MAX6921_FONT_PATTERN_BYTES;
+    return (uint32_t)pgm_read_byte(p)
+         | ((uint32_t)pgm_read_byte(p + 1) << 8)
+         | ((uint32_t)pgm_read_byte(p + 2) << 16);
+}
+
+struct MAX6921_TubeProfile {
+    const char* name;                     // PROGMEM 문자열 (max6921FindTubeProfile 검색 키)
+    uint8_t numGrids;
+    uint8_t numSegments;
+    uint8_t numChips;
+    uint8_t frameBytes;                   // 그리드 1개 전송 프레임 (MAX6921_CHAIN_BYTES(numChips))
+    uint8_t maxBrightness;
+
+    // 체인 출력 맵 (모두 PROGMEM, tools/gen_output_map.py 출력)
+    const uint8_t* gridFrame;             // [numGrids][frameBytes] 그리드 선택 비트만 켜진 프레임
+    const uint8_t* segmentFrameByte;      // [numSegments] 세그먼트 → 프레임 바이트 인덱스
+    const uint8_t* segmentFrameMask;      // [numSegments] 세그먼트 → 비트 마스크
+    const uint8_t* gridChainBit;          // [numGrids] 시뮬레이터용
+    const uint8_t* segmentChainBit;       // [numSegments] 시뮬레이터용
+
+    // 폰트 (PROGMEM)
+    const uint8_t* font;                  // [MAX6921_TUBE_FONT_SIZE * 3] 문자 코드 0x20-0x7F → 패킹된 패턴 (소문자 포함)
+    const uint8_t* digits;                // [10 * 3] 숫자 표시 경로 전용
+
+    // 구두점 애넌시에이터 (없으면 VFD_NO_SEGMENT / 0, MAX6921_TextLayout.h 참조)
+    uint8_t dpSegment;
+    uint8_t colonSegment;
+    uint16_t dpGrids;                     // bit n = Gn에 소수점 있음
+    uint16_t colonGrids;                  // bit n = Gn에 콜론 있음
+    uint8_t clockColonGrid;               // setColon()/displayTime()의 시:분 콜론
+};
+
+// PROGMEM 프로필 포인터 배열에서 이름으로 검색 (없으면 NULL)
+const MAX6921_TubeProfile* max6921FindTubeProfile(const MAX6921_TubeProfile* const* registry, uint8_t count, const char* name);
+
+// PROGMEM 프로필 → RAM 복사본
+void max6921LoadTubeProfile(const MAX6921_TubeProfile* profile, MAX6921_TubeProfile* out);
+
+#endif // MAX6921_TUBE_PROFILE_H
@@ -23,13 +23,15 @@
  * 2. 데이터 전송 순서:
  *    - 첫 번째: MAX6921 #2 데이터 (체인의 끝에서부터)
  *    - 두 번째: MAX6921 #1 데이터
- *    - 총 40비트 전송 (각 칩당 20비트)
+ *    - 총 40비트 전송 (각 칩당 20비트, 5바이트로 연속 전송)
+ *    - 칩 수는 VFD 설정에서 자동 계산 (VFD_REQUIRED_CHIPS)
+ *    - 자세한 프레임 형식은 MAX6921_Transport.h 참조
  * 
  * ===== MSB 전송 방식 =====
  * 
  * - MSB First (Most Significant Bit 먼저 전송)
  * - SPI 설정: MSBFIRST 모드 사용
- * - 비트 순서: 0, 1, 2, ..., 18, 19 (낮은 비트부터)
+ * - 비트 순서: 각 칩의 OUT19 → OUT0
  * 
  * ===== BIT 방식 데이터 표현 =====
  * 
@@ -48,70 +50,404 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include "MAX6921_Config.h"
+#include "MAX6921_Transport.h"
+#include "MAX6921_GridStore.h"
+#include "MAX6921_Effects.h"
+#include "MAX6921_TextLayout.h"
+#include "MAX6921_GlyphCache.h"
+#include "MAX6921_TubeProfile.h"
+
+// Note: VFD-specific configurations (VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS) 
+// come from the tube config selected in MAX6921_Config.h (기본: VFD_7BT317NK_Config.h)
+
+// 기본 튜브 설정을 기반으로 한 자동 계산
+#define VFD_TOTAL_BITS (VFD_NUM_GRIDS + VFD_NUM_SEGMENTS)  // 총 필요 비트
+#define VFD_REQUIRED_CHIPS ((VFD_TOTAL_BITS + MAX6921_OUTPUT_BITS - 1) / MAX6921_OUTPUT_BITS)  // 올림 계산
+#define VFD_TOTAL_OUTPUT_BITS (VFD_REQUIRED_CHIPS * MAX6921_OUTPUT_BITS)  // 총 출력 비트
+#define VFD_UNUSED_BITS (VFD_TOTAL_OUTPUT_BITS - VFD_TOTAL_BITS)  // 사용하지 않는 비트
+
+// 데이터 마스크 정의 (사용하지 않는 비트를 0으로 만들기 위해)
+#define VFD_CHIP1_VALID_MASK ((1UL << MAX6921_OUTPUT_BITS) - 1)  // 첫 번째 칩: 20비트 모두 사용
+#define VFD_CHIP2_VALID_BITS (VFD_TOTAL_BITS - MAX6921_OUTPUT_BITS)  // 두 번째 칩에서 사용할 비트 수
+#define VFD_CHIP2_VALID_MASK ((1UL << VFD_CHIP2_VALID_BITS) - 1)  // 두 번째 칩: 사용할 비트만 마스킹
+
+// 그리드별 전송 프레임 크기 (칩 워드를 빈틈없이 채움: 2칩 = 5바이트)
+#define VFD_FRAME_BYTES MAX6921_CHAIN_BYTES(VFD_REQUIRED_CHIPS)
+
+static_assert(VFD_FRAME_BYTES == VFD_MAP_FRAME_BYTES, "VFD output map was generated for a different chip count");
+
+// 저장소 용량(VFD_MAX_*)은 MAX6921_Config.h에서 정의 (빌드 플래그로 변경 가능)
+static_assert(VFD_MAX_GRIDS <= 16, "dirty grid tracking supports up to 16 grids");
+static_assert(VFD_MAX_GRIDS >= VFD_NUM_GRIDS && VFD_MAX_SEGMENTS >= VFD_NUM_SEGMENTS &&
+              VFD_MAX_FRAME_BYTES >= VFD_FRAME_BYTES, "storage capacity smaller than the default tube");
+static_assert(VFD_MAX_FRAME_BYTES <= MAX6921_ASYNC_MAX_BYTES, "frame larger than the async transport buffer");
+
 
 // Library version
 #define MAX6921_VFD_DRIVER_VERSION "1.0.0"
 
-// Note: Pin assignments and VFD specifications must be defined in main code
-// by including appropriate VFD config file before including this header
+// Note: Pin assignments must be defined in VFD config file
 
 // Timing constants
 #define DEFAULT_GRID_SCAN_DELAY_US  2000  // Microseconds per grid
 #define DEFAULT_SPI_CLOCK_SPEED     4000000  // 4MHz SPI clock
+#define DEFAULT_BLANK_GUARD_US      50       // 그리드 슬롯 시작의 BLANK 구간 (프레임 전송 + LOAD 시간 확보)
+#define DEFAULT_BLANK_LEAD_US       0        // BLANK → LOAD 최소 간격 (0 = 프레임 전송 시간만)
+#define DEFAULT_BLANK_TRAIL_US      0        // LOAD → BLANK 해제 최소 간격
+#ifndef MAX6921_TIMER_MAX_LEAD_US
+#define MAX6921_TIMER_MAX_LEAD_US   10       // 타이머 ISR 안에서 기다리는 lead 상한 (나머지는 LOAD 뒤 BLANK 구간으로)
+#endif
+
+// 목표 화면 주파수 모드 (setTargetFrameRate)
+#define MAX6921_MIN_DISPLAY_US      100      // 그리드 슬롯의 최소 표시 구간 (이보다 짧아지는 주파수는 제한됨)
+#define MAX6921_TRANSFER_MARGIN_US  8        // 측정한 전송 시간에 더하는 BLANK 예약 여유
+
+// 그리드 스캔 순서 (슬롯 0은 항상 그리드 0이므로 페이지 플립/페이드 경계는 같음)
+enum MAX6921_ScanOrder {
+    MAX6921_SCAN_SEQUENTIAL = 0,          // 0, 1, 2, ... (기본)
+    MAX6921_SCAN_INTERLEAVED              // 짝수 그리드 다음 홀수 그리드 (7그리드: 0, 2, 4, 6, 1, 3, 5)
+};
+
+// 하드웨어 타이머 스캔 지원 여부 (AVR Timer1 사용)
+// 타이머 모드에서는 ISR이 그리드 순환을 전담하고, loop()에서는 프레임버퍼만 수정
+// (호스트 테스트는 Timer1 모델을 제공하고 빌드 플래그로 1을 지정, tests/host 참조)
+#ifndef MAX6921_HAS_SCAN_TIMER
+#if defined(__AVR__) && defined(TIMER1_OVF_vect) && defined(TIMER1_COMPB_vect)
+#define MAX6921_HAS_SCAN_TIMER      1
+#else
+#define MAX6921_HAS_SCAN_TIMER      0
+#endif
+#endif
+
+// 단계별 실행 시간 측정 (examples/Benchmark 참조)
+// 켜려면 아래 주석을 해제하거나 빌드 플래그로 -DMAX6921_PROFILE 지정
+// 측정 시계는 기본 micros(), Cortex-M 등에서는 사이클 카운터로 대체 가능
+//   예: #define MAX6921_PROFILE_CLOCK() (DWT->CYCCNT)
+// #define MAX6921_PROFILE
+#ifdef MAX6921_PROFILE
+#ifndef MAX6921_PROFILE_CLOCK
+#define MAX6921_PROFILE_CLOCK()     micros()
+#endif
+
+enum MAX6921_ProfileStage {
+    MAX6921_STAGE_FONT_LOOKUP = 0,        // 문자 → 세그먼트 패턴
+    MAX6921_STAGE_ENCODE,                 // 그리드 프레임 인코딩
+    MAX6921_STAGE_TRANSFER,               // 프레임 전송 + LOAD
+    MAX6921_STAGE_BLANK,                  // BLANK 핀 전환
+    MAX6921_STAGE_GRID,                   // 그리드 1개 스캔 전체
+    MAX6921_STAGE_FRAME,                  // 화면 1장 (모든 그리드 스캔 합)
+    MAX6921_STAGE_COUNT
+};
+
+struct MAX6921_ProfileCounter {
+    uint32_t count;                       // 측정 횟수
+    uint32_t total;                       // 누적 시간 (시계 단위)
+    uint32_t max;                         // 최대 1회 시간
+};
+#endif
+
+// 밝기 → 표시 비율 (16비트 고정소수점, 감마 2.0 근사)
+uint16_t max6921BrightnessToDuty(uint8_t brightness, uint8_t maxBrightness);
+
+// 저장소 용량에 맞춘 세그먼트 저장소 (7BT317NK 설정: uint32_t x 8)
+typedef MAX6921_GridStore<VFD_MAX_GRIDS, VFD_MAX_SEGMENTS> VFD_GridStore;
+typedef VFD_GridStore::Mask VFD_SegmentMask;
+
+// 그리드별 전송 프레임 묶음 (화면 1장)
+struct MAX6921_FrameBuffer {
+    uint8_t frames[VFD_MAX_GRIDS][VFD_MAX_FRAME_BYTES];  // 프로필의 그리드 수 x 프레임 크기만 사용
+};
 
 class MAX6921_VFD_Driver {
+    friend class MAX6921_EffectEngine;    // 효과는 back 버퍼와 그리드별 표시 시간을 직접 조절
+    
 private:
     // Hardware pin assignments
     uint8_t _loadPin;      // Common LOAD pin for all MAX6921 chips
     uint8_t _blankPin;     // Common BLANK pin for all MAX6921 chips
     
-    // Display data
-    uint32_t _gridData[VFD_NUM_GRIDS];    // Segment data for each grid
-    uint8_t _displayBuffer[VFD_NUM_DIGITS]; // Character buffer
-    uint8_t _currentGrid;                 // Current active grid
-    uint8_t _brightness;                  // Display brightness (0-255)
+    // 체인 전송 계층 (기본: 하드웨어 SPI)
+    MAX6921_SPITransport _spiTransport;
+    MAX6921_Transport* _transport;
+    
+    // 튜브 프로필 (PROGMEM 프로필의 RAM 복사본, 테이블 포인터는 플래시를 가리킴)
+    // 아래 값들은 프로필에서 가져오며 생성자의 numGrids/numSegments는 호환용으로만 받음
+    MAX6921_TubeProfile _tube;
+    uint8_t _numGrids;     // Number of grids for this VFD
+    uint8_t _numSegments;  // Number of segments for this VFD
+    uint8_t _frameBytes;   // 그리드 1개 전송 프레임 크기
+    uint8_t _maxBrightness; // Maximum brightness for this VFD
+    VFD_SegmentMask _segmentMask;         // 프로필의 세그먼트 비트만 1
+    
+    // Display data (크기와 정수형은 저장소 용량에서 컴파일 타임에 결정, MAX6921_GridStore.h 참조)
+    VFD_GridStore _gridData;
+    
+    // 그리드별로 미리 계산된 전송 프레임 (스캔 핫패스는 바이트 복사만 수행)
+    // _gridData가 바뀔 때만 encodeGrid()로 back 버퍼에 다시 만들어짐
+    //
+    // 페이지 플립 (화면 찢어짐 방지):
+    //   _back  : 그리기 전용 (foreground만 접근)
+    //   _ready : present()로 넘겨진 완성 화면, 다음 그리드 0 경계에서 표시
+    //   _front : 스캔 중인 화면 (ISR만 읽음)
+    // present()와 ISR은 포인터만 교환하므로 스캔은 항상 완성된 화면만 전송하고
+    // foreground는 플립을 기다리며 멈추지 않음
+    MAX6921_FrameBuffer _frameBuffers[3];
+    MAX6921_FrameBuffer* volatile _front;
+    MAX6921_FrameBuffer* volatile _ready;
+    MAX6921_FrameBuffer* _back;
+    volatile bool _flipPending;           // _ready에 아직 표시되지 않은 화면이 있음
+    bool _autoPresent;                    // 그리기 함수 호출마다 자동 present()
+    
+    // 변경된 그리드 추적 (bit n = 그리드 n의 _gridData가 back 프레임과 다름)
+    // present() 시 변경된 그리드만 다시 인코딩
+    uint16_t _dirtyGrids;
+    uint8_t _lastRebuildCount;            // 마지막 present()에서 인코딩한 그리드 수
+    uint32_t _totalRebuildCount;          // 누적 인코딩 그리드 수
+    uint32_t _fontLookupCount;            // 누적 폰트 조회 수
+    
+    uint8_t _displayBuffer[VFD_MAX_GRIDS]; // Character buffer (그리드당 1문자, 사용자 글리프는 슬롯 코드, 0 = 임의 패턴)
+    uint8_t _displayMarks[VFD_MAX_GRIDS];  // 그리드별 구두점 표시 (MAX6921_MARK_DP | MAX6921_MARK_COLON)
+    volatile uint8_t _currentGrid;        // Current active grid (ISR에서 갱신)
+    volatile uint8_t _scanSlot;           // 현재 스캔 슬롯 (_scanOrder 인덱스)
+    uint8_t _scanOrder[VFD_MAX_GRIDS];    // 슬롯 → 그리드 (setScanOrder()로 생성)
+    uint8_t _scanOrderMode;               // MAX6921_ScanOrder
+    volatile uint8_t _brightness;         // Display brightness (0-255), 페이드 중에는 현재 값
+    uint8_t _nominalBrightness;           // setBrightness()로 지정한 밝기 (fadeIn 목표값)
+    
+    // BLANK PWM 밝기 제어
+    // 그리드 슬롯 = [BLANK 구간: lead + 프레임 전송 + LOAD + trail][표시 구간: 밝기에 비례][BLANK]
+    volatile uint16_t _gridOnTimeUs[VFD_MAX_GRIDS]; // 그리드별 표시 시간 (감마 + 드웰 보정 적용)
+    uint8_t _gridDwellTrim[VFD_MAX_GRIDS];  // 그리드별 드웰 보정 (255 = 보정 없음)
+    uint8_t _gridEffectLevel[VFD_MAX_GRIDS]; // 효과(깜박임/크로스페이드)에 의한 그리드별 밝기 (255 = 100%)
+    bool _blanked;                        // 폴링 모드에서 BLANK 상태
+    volatile bool _releaseOnLatch;        // 전송 완료(LOAD 상승) 시 BLANK 해제 예약
+    bool _blankHardwarePwm;               // BLANK 핀이 Timer1 출력 비교 핀이면 하드웨어 PWM 사용
+    
+    // 고스팅 방지 BLANK 가드 (폴링 모드 슬롯 진행 단계, 블로킹 없음)
+    enum ScanPhase {
+        SCAN_SHOW = 0,                    // 표시 구간 (또는 밝기에 의한 BLANK)
+        SCAN_LEAD,                        // BLANK 후 lead 대기 → 프레임 전송
+        SCAN_LATCH,                       // 전송 중 (LOAD 대기)
+        SCAN_TRAIL                        // LOAD 후 trail 대기 → BLANK 해제
+    };
+    uint16_t _blankLeadUs;                // BLANK → LOAD 최소 간격
+    uint16_t _blankTrailUs;               // LOAD → BLANK 해제 최소 간격
+    volatile uint8_t _scanPhase;
+    volatile unsigned long _latchTime;    // 마지막 LOAD 상승 시각 (폴링 모드 trail/표시 구간 기준)
+    uint16_t _timerTop;                   // Timer1 TOP (그리드 주기 - 1)
+    volatile uint16_t _pendingTimerTop;   // 실행 중 주기 변경: 다음 ISR에서 비교 값부터 적용할 TOP (0 = 없음)
+    uint16_t _armedTimerTop;              // 이 TOP 기준 비교 값이 버퍼에 있음, 다음 ISR에서 ICR1에 적용 (0 = 없음)
+    
+    // Fade engine (프레임마다 한 번 진행, 블로킹 없음)
+    volatile bool _fading;
+    uint8_t _fadeFrom;
+    uint8_t _fadeTo;
+    unsigned long _fadeStartMs;
+    uint16_t _fadeDurationMs;
+    
+    // 논블로킹 효과 (refresh()마다 진행)
+    MAX6921_EffectEngine _effects;
+    
+    // 사용자 글리프 (폰트보다 먼저 조회) + 폰트/캐시 모두 없는 문자의 대체 패턴
+    MAX6921_GlyphCache _glyphs;
+    uint32_t _fallbackGlyph;
     
     // Timing
     uint16_t _gridScanDelay;              // Grid scan delay in microseconds
-    unsigned long _lastGridScan;          // Last grid scan timestamp
+    unsigned long _lastGridScan;          // Last grid scan timestamp (목표 주파수 모드에서는 예정 시각)
+    
+    // 목표 화면 주파수 (0 = setGridScanDelay()의 고정 주기)
+    // 그리드 주기 = 1초 / (주파수 x 그리드 수), 전송 시간이 BLANK 예약을 넘으면 예약을 늘림
+    uint16_t _targetFrameRate;
+    uint16_t _scanReserveUs;              // 슬롯 앞 BLANK 예약 (전송 + LOAD, 최소 DEFAULT_BLANK_GUARD_US)
+    bool _frameRateLimited;               // 목표 주파수를 낼 수 없어 주기를 늘림
+    volatile unsigned long _transferStart;
+    volatile uint16_t _frameTransferUs;   // 현재 화면의 최대 그리드 전송 시간
+    volatile uint16_t _transferTimeUs;    // 직전 화면의 최대 그리드 전송 시간
+    
+    // 스캔 통계 (화면 경계에서 갱신)
+    volatile unsigned long _frameStart;
+    volatile uint32_t _framePeriodUs;     // 화면 주기 (지수 평균)
+    volatile uint32_t _frameCount;
+    volatile uint32_t _missedDeadlines;   // BLANK 예약보다 늦게 시작한 그리드 슬롯 수
+    volatile bool _frameDone;             // refresh()에서 주기 재계산
+    
+    // Timer scan mode
+    volatile bool _timerScan;             // true: 타이머 ISR이 스캔 담당
+    volatile uint16_t _maxScanTimeUs;     // ISR 1회 최대 소요 시간 (측정값)
+    
+#ifdef MAX6921_PROFILE
+    MAX6921_ProfileCounter _profile[MAX6921_STAGE_COUNT];
+    uint32_t _profileFrameTime;           // 현재 화면의 그리드 스캔 시간 합
+    void profileRecord(uint8_t stage, uint32_t elapsed);
+#endif
     
     // Internal methods
     void initializePins();
+    void applyTubeProfile(const MAX6921_TubeProfile& tube);  // 형상 교체 + 화면 비우기 + 모든 프레임 다시 인코딩
+    void scanNextGrid();                  // 다음 그리드 1개 전송 (스캔 핫패스)
+    void encodeGrid(uint8_t grid);        // _gridData[grid] → _back->frames[grid]
+    void setGridData(uint8_t grid, VFD_SegmentMask segmentMask); // 값이 바뀐 경우만 dirty 표시
+    void flushDirtyGrids();               // dirty 그리드만 인코딩
+    void clearBuffer();                   // back 버퍼 지우기 (present 없음)
+    void drawCharacter(uint8_t position, char character);  // 구두점 표시 없이 그리기
+    void drawCell(uint8_t position, char character, uint8_t marks);
+    bool cellUnchanged(uint8_t position, char character, uint8_t marks);  // 같은 문자면 구두점만 맞추고 true
+    void storeCell(uint8_t position, char character, uint32_t pattern, uint8_t marks);
+    void drawNumber(int32_t value, uint8_t decimals, bool leadingZeros);
+    void drawNumberCell(uint8_t grid, char character, uint8_t marks);  // 글리프 덮어쓰기 → 숫자 테이블 순
+    void setMarks(uint8_t position, uint8_t marks);  // 폰트 조회 없이 구두점 세그먼트만 교체
+    VFD_SegmentMask markSegments(uint8_t grid, uint8_t marks);
+    uint8_t litMarks(uint8_t grid);                  // 그리드에 켜져 있는 구두점 표시
+    void autoPresent();                   // _autoPresent이면 present()
+    void sendFrame(const uint8_t* frame); // 미리 계산된 프레임 전송
+    void setBlank(bool blank);            // BLANK 핀 직접 제어 (true = 출력 끔)
+    void onTransferComplete();            // 프레임 래치 직후 (비동기 전송이면 SPI ISR 문맥)
+    static void transferCompleteCallback(void* context);
+    void updateBlankTiming();             // 밝기/주기 변경 시 그리드별 표시 시간 재계산
+    void computeGridOnTimes(uint16_t periodUs, uint16_t* onTimes);
+    void updateFade();                    // 프레임 경계에서 페이드 진행
+    uint16_t blankCompareValue(uint8_t grid, uint16_t top); // 타이머 모드 BLANK 해제 시점 (Timer1 카운트)
+    bool retimeTimerScan(uint16_t periodUs);  // 타이머를 멈추지 않고 주기 변경
+    void buildScanOrder();                // _scanOrderMode + 그리드 수 → _scanOrder
+    void applyGridPeriod(uint16_t periodUs);  // 폴링/타이머 공통 그리드 주기 적용
+    void updateScanRate();                // 목표 주파수 + 측정 전송 시간 → 그리드 주기 (foreground)
     void sendData(uint32_t data1, uint32_t data2);
-    uint32_t getCharacterPattern(char character);
+    void sendDataWithMask(uint32_t data1, uint32_t data2);  // 자동 마스킹 포함
+    uint32_t getCharacterPattern(char character);  // 자리 문자 코드 → 사용자 글리프 / 프로필 폰트 / 대체 글리프
+    void releaseGlyphCells(uint8_t slot); // 지울 슬롯을 가리키는 자리를 원래 문자(ASCII) 또는 미지원 문자로
+    void refreshGlyphCells();             // 글리프/대체 패턴 변경 후 문자 자리 다시 그리기
+    uint32_t getDigitPattern(uint8_t digit);
+    
+    // 자동 마스킹 함수들
+    uint32_t applyChip1Mask(uint32_t data);
+    uint32_t applyChip2Mask(uint32_t data);
     
 public:
-    // Constructor - pin assignments must be provided by main code
-    MAX6921_VFD_Driver(uint8_t loadPin, uint8_t blankPin);
+    // Constructor - pin assignments and VFD configuration must be provided
+    MAX6921_VFD_Driver(uint8_t loadPin, uint8_t blankPin, 
+                       uint8_t numGrids, uint8_t numSegments, uint8_t maxBrightness);
     
     // Initialization
+    // 프로필을 지정하지 않으면 현재 프로필 유지 (처음에는 VFD_DEFAULT_PROFILE)
+    // 저장소 용량을 넘는 프로필이면 false
     bool begin();
     bool begin(uint32_t spiClockSpeed);
+    bool begin(const MAX6921_TubeProfile* profile, uint32_t spiClockSpeed = DEFAULT_SPI_CLOCK_SPEED);
+    
+    // 튜브 프로필 교체 (PROGMEM 프로필, 화면은 비워짐). 스캔이 멈춘 상태에서 호출할 것
+    bool setTubeProfile(const MAX6921_TubeProfile* profile);
+    const MAX6921_TubeProfile& getTubeProfile();   // RAM 복사본 (테이블 포인터는 PROGMEM)
+    const char* getTubeName();            // PROGMEM 문자열 (Serial.print((const __FlashStringHelper*)...))
+    uint8_t getNumGrids();
+    uint8_t getNumSegments();
     
     // Basic display control
     void clear();
     void refresh();
+    
+    // Page flip (그리기는 back 버퍼에만 반영되고 present() 시 그리드 0 경계에서 표시)
+    void present();
+    void setAutoPresent(bool enable);     // 기본 true: 그리기 함수마다 자동 present()
+    bool isFlipPending();
+    
+    // Update statistics (변경된 그리드만 다시 만드는지 확인용)
+    uint8_t getLastRebuildCount();
+    uint32_t getTotalRebuildCount();
+    uint32_t getFontLookupCount();
+    void resetUpdateStats();
+    
+    // Timer-interrupt scan mode (refresh() 호출 없이 일정 주기로 스캔)
+    bool beginTimerScan(uint16_t gridPeriodUs = DEFAULT_GRID_SCAN_DELAY_US);
+    void endTimerScan();
+    bool isTimerScanActive();
+    uint16_t getMaxScanTimeUs();
+    void resetScanStats();                // 최대 ISR 시간 + 아래 화면 주파수 통계 초기화
+    
+    // 목표 화면 주파수 (Hz, 0 = 끔). 그리드 수와 측정한 전송 시간(SPI 클록, 칩 수)으로 그리드 주기를
+    // 정하고 refresh()에서 화면마다 다시 맞춤 (타이머 모드 포함, setGridScanDelay()를 호출하면 꺼짐)
+    void setTargetFrameRate(uint16_t hz);
+    uint16_t getTargetFrameRate();
+    bool isFrameRateLimited();            // 최소 슬롯(예약 + 가드 + MAX6921_MIN_DISPLAY_US)에 걸림
+    uint16_t getAchievedFrameRate();      // 측정한 화면 주파수 (Hz, 반올림)
+    uint32_t getFramePeriodUs();          // 측정한 화면 주기 (지수 평균)
+    uint32_t getScanFrameCount();
+    uint32_t getMissedDeadlineCount();    // BLANK 예약 구간보다 늦게 시작한 그리드 슬롯 수
+    uint16_t getTransferTimeUs();         // 측정한 그리드 전송 시간 (목표 주파수 모드에서만)
+    void scanISR();                       // 타이머 ISR 전용 (직접 호출하지 말 것)
+    
+    // 외부 스캐너(MAX6921_DisplayManager)용: 다음 그리드로 이동(플립/페이드 포함)하고
+    // 전송할 프레임만 반환 (전송, LOAD, BLANK는 호출한 쪽이 담당)
+    const uint8_t* advanceScan();
+    uint8_t getLoadPin();
+    void blankReleaseISR();               // 타이머 ISR 전용 (소프트웨어 BLANK PWM)
     void setBrightness(uint8_t brightness);
     uint8_t getBrightness();
+    void setGridDwellTrim(uint8_t grid, uint8_t trim);  // 그리드별 밝기 편차 보정 (255 = 100%)
+    
+    // 고스팅 방지: LOAD 앞뒤로 BLANK를 유지할 최소 시간 (us)
+    // lead = BLANK → LOAD (이전 그리드 출력이 완전히 꺼질 시간), trail = LOAD → BLANK 해제
+    // 두 구간은 그리드 슬롯에서 표시 시간 대신 빠짐. 타이머 모드의 lead는 ISR 안에서 대기 (MAX6921_TIMER_MAX_LEAD_US까지)
+    void setBlankGuard(uint16_t leadUs, uint16_t trailUs = DEFAULT_BLANK_TRAIL_US);
+    uint16_t getBlankLeadUs();
+    uint16_t getBlankTrailUs();
+    
+    // 그리드 스캔 순서 (MAX6921_SCAN_INTERLEAVED: 이웃 그리드를 연속으로 켜지 않아 발열 분산,
+    // 남은 고스트가 인접 자리에 나타나지 않음). 튜브 프로필을 바꿔도 유지
+    void setScanOrder(uint8_t order);
+    uint8_t getScanOrder();
     
     // Character and string display
-    void displayCharacter(uint8_t position, char character);
+    // displayString()은 '.'/':'를 앞 자리의 소수점/콜론으로 합쳐 배치 (MAX6921_TextLayout.h 참조)
+    void displayCharacter(uint8_t position, char character);  // 해당 자리의 구두점 표시는 지워짐
     void displayString(const char* text);
     void displayString(String text);
     
-    // Numeric display
+    // 사용자 글리프 (RAM 캐시 MAX6921_GLYPH_CACHE_SIZE개, MAX6921_GlyphCache.h 참조)
+    // displayString()은 UTF-8 문자로, displayCharacter()와 효과는 바이트(Latin-1 코드)로 찾음
+    // 패턴은 현재 튜브 기준이므로 튜브 프로필을 바꾸면 모두 지워짐. 화면의 해당 문자는 바로 갱신
+    bool defineGlyph(uint16_t codePoint, uint32_t pattern);      // 슬롯이 없으면 false
+    bool defineGlyph(const char* character, uint32_t pattern);   // UTF-8 문자 1개 ("°", "\u2192", "\xB0")
+    bool removeGlyph(uint16_t codePoint);
+    void clearGlyphs();
+    uint8_t getGlyphCount();
+    // 폰트에도 캐시에도 없는 문자의 표시 (기본 0 = 공백)
+    void setFallbackGlyph(uint32_t pattern);
+    void setFallbackCharacter(char character);         // 내장 문자 패턴 사용 (예: '_')
+    uint32_t getFallbackGlyph();
+    
+    // Numeric display (오른쪽 정렬, snprintf 없이 숫자 전용 폰트 테이블로 바로 그리드 마스크 생성)
+    // 자리가 모자라면 모든 자리에 '-' 표시. 소수점은 일의 자리 그리드의 애넌시에이터
     void displayNumber(int number);
     void displayNumber(long number);
-    void displayFloat(float number, uint8_t decimals = 2);
+    void displayFixed(long value, uint8_t decimals, bool leadingZeros = false);  // value / 10^decimals
+    void displayFloat(float number, uint8_t decimals = 2);  // 반올림 후 displayFixed()
     
     // Special characters and symbols
+    // 문자는 그대로 두고 애넌시에이터 세그먼트만 변경 (해당 그리드에 없으면 무시)
     void setDecimalPoint(uint8_t position, bool state);
-    void setColon(bool state);
-    void displayTime(uint8_t hours, uint8_t minutes);
+    void setColon(bool state);                        // 프로필 clockColonGrid의 콜론
+    void setColon(uint8_t position, bool state);
+    void displayTime(uint8_t hours, uint8_t minutes); // "HH:MM" (콜론은 시 둘째 자리)
     
     // Raw segment control
+    // setSegment() 뒤 그리드의 구두점 표시는 실제 소수점/콜론 세그먼트 상태를 따름 (직접 끈 표시는 해제)
     void setSegment(uint8_t grid, uint8_t segment, bool state);
-    void setGrid(uint8_t grid, uint32_t segmentMask);
+    void setGrid(uint8_t grid, uint64_t segmentMask);
+    
+    // 그리드 비트맵 일괄 기록 (범위는 한 번만 잘라내고 모든 그리드를 쓴 뒤 present() 1회)
+    // 바뀐 그리드만 back 버퍼 프레임으로 다시 인코딩됨. _P는 PROGMEM 배열
+    void setGrids(uint8_t first, const VFD_SegmentMask* masks, uint8_t count);
+    void setGrids_P(uint8_t first, const VFD_SegmentMask* masks, uint8_t count);
+    void setFrame(const VFD_SegmentMask* masks);    // 전체 화면 (getNumGrids()개)
+    void setFrame_P(const VFD_SegmentMask* masks);
+    void sendDataDirect(uint32_t data1, uint32_t data2);  // 직접 데이터 전송
+    
+    // 전송 계층 교체 (begin() 전에 호출, NULL이면 기본 SPI 전송 사용)
+    // 비동기 전송(MAX6921_AsyncSPITransport)이면 BLANK 해제는 프레임 래치 이후로 미뤄짐
+    void setTransport(MAX6921_Transport* transport);
+    uint8_t getFrameBytes();
     
     // Test and diagnostic functions
     void displayTest();
@@ -119,16 +455,34 @@ public:
     void gridTest();
     
     // Configuration
-    void setGridScanDelay(uint16_t delayMicros);
+    void setGridScanDelay(uint16_t delayMicros);  // 고정 그리드 주기 (목표 화면 주파수 모드 해제)
     uint16_t getGridScanDelay();
     
-    // Animation and effects
+    // Animation and effects (모두 논블로킹, refresh()에서 진행)
+    // scrollText()는 전체 자리 마퀴 반복 (text는 효과가 끝날 때까지 유지되어야 함)
     void scrollText(const char* text, uint16_t delayMs = 200);
+    MAX6921_EffectEngine& effects();      // 범위별 마퀴/깜박임/와이프/크로스페이드
     void fadeIn(uint16_t durationMs = 1000);
     void fadeOut(uint16_t durationMs = 1000);
+    void fadeTo(uint8_t brightness, uint16_t durationMs);
+    bool isFading();
     
     // Utility functions
     bool isValidPosition(uint8_t position);
+    
+    // VFD 설정 정보 함수들 (디버깅용)
+    uint8_t getTotalBits();
+    uint8_t getRequiredChips(); 
+    uint8_t getUnusedBits();
+    void printVFDInfo();  // 시리얼로 VFD 설정 정보 출력
+    
+#ifdef MAX6921_PROFILE
+    // 단계별 실행 시간 (ISR에서 기록되므로 복사본을 반환)
+    MAX6921_ProfileCounter getProfile(uint8_t stage);
+    void resetProfile();
+    void printProfileCSV();  // stage,count,total,avg,max 형식으로 시리얼 출력
+    static const char* getProfileStageName(uint8_t stage);  // CSV 단계 이름 ("font_lookup" 등)
+#endif
     const char* getVersion();
 };
 
@@ -0,0 +1,110 @@
+/*
+ * VFD_7BT317NK_Config.h
+ * 
+ * Hardware configuration for 7BT317NK VFD display
+ * Defines grid count, segment count, and pin mappings specific to this VFD
+ * 
+ * This file provides the hardware specifications that MAX6921_VFD_Driver needs
+ * to operate with the 7BT317NK display.
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef VFD_7BT317NK_CONFIG_H
+#define VFD_7BT317NK_CONFIG_H
+
+#include <Arduino.h>
+#include "VFD_7BT317NK_Map.h"   // 연결 테이블(JSON)에서 생성된 체인 출력 맵
+#include "VFD_7BT317NK_Profile.h"  // 출력 맵 + 폰트 + 애넌시에이터를 묶은 튜브 프로필
+
+// VFD Hardware Specifications
+#define VFD_NUM_GRIDS      7     // G0-G6 (그리드 수 = 자릿수)
+#define VFD_NUM_SEGMENTS   21    // P0-P20 (세그먼트 수)
+#define VFD_MAX_BRIGHTNESS 255   // 최대 밝기 레벨
+
+// 구두점 애넌시에이터 (문자열의 '.'/':'를 앞 자리에 합칠 때 사용, MAX6921_TextLayout.h 참조)
+// 7BT317NK는 자리마다 점 세그먼트(P20) 하나뿐이므로 소수점과 콜론이 같은 세그먼트를 쓴다
+// 애넌시에이터가 없는 튜브는 VFD_NO_SEGMENT로 지정
+#define VFD_DP_SEGMENT        20      // P20: 소수점
+#define VFD_COLON_SEGMENT     20      // P20: 콜론 (폰트의 ':' 패턴과 같음)
+#define VFD_DP_GRIDS          0x7F    // 소수점이 있는 그리드 (bit n = Gn)
+#define VFD_COLON_GRIDS       0x7F    // 콜론이 있는 그리드 (bit n = Gn)
+#define VFD_CLOCK_COLON_GRID  1       // setColon()/displayTime()의 시:분 콜론 (시 둘째 자리)
+
+// 튜브 프로필 (MAX6921_TubeProfile.h 참조)
+// begin()에 프로필을 넘기지 않으면 이 튜브로 동작
+#define VFD_DEFAULT_PROFILE   (&VFD_7BT317NK_PROFILE)
+
+// Note: 드라이버 저장소 용량(VFD_MAX_*)은 MAX6921_Config.h에서 정의됨
+// Note: MAX6921 하드웨어 사양과 비트 계산은 MAX6921_VFD_Driver.h에서 정의됨
+
+// 이 튜브의 체인 출력 맵 (드라이버는 프로필을 통해 참조, 시뮬레이터 등에서 직접 사용 가능)
+// 배선이 바뀌면 vfd-configs/connection-tables/7BT317NK.json 수정 후
+// tools/gen_output_map.py로 VFD_7BT317NK_Map.h를 다시 생성
+#define VFD_MAP_FRAME_BYTES        VFD_7BT317NK_MAP_FRAME_BYTES
+#define VFD_GRID_FRAME             VFD_7BT317NK_GRID_FRAME
+#define VFD_SEGMENT_FRAME_BYTE     VFD_7BT317NK_SEGMENT_FRAME_BYTE
+#define VFD_SEGMENT_FRAME_MASK     VFD_7BT317NK_SEGMENT_FRAME_MASK
+#define VFD_GRID_CHAIN_BIT         VFD_7BT317NK_GRID_CHAIN_BIT
+#define VFD_SEGMENT_CHAIN_BIT      VFD_7BT317NK_SEGMENT_CHAIN_BIT
+
+static_assert(VFD_NUM_GRIDS == VFD_7BT317NK_MAP_GRIDS, "grid count differs from connection table");
+static_assert(VFD_NUM_SEGMENTS == VFD_7BT317NK_MAP_SEGMENTS, "segment count differs from connection table");
+
+// Grid pin assignments for MAX6921 chips
+// G0-G6 are mapped to specific output pins on the MAX6921 chips
+#define VFD_GRID_G0_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G0_PIN     0    // OUT0
+#define VFD_GRID_G1_CHIP    1    // First MAX6921 chip  
+#define VFD_GRID_G1_PIN     1    // OUT1
+#define VFD_GRID_G2_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G2_PIN     2    // OUT2
+#define VFD_GRID_G3_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G3_PIN     3    // OUT3
+#define VFD_GRID_G4_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G4_PIN     4    // OUT4
+#define VFD_GRID_G5_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G5_PIN     5    // OUT5
+#define VFD_GRID_G6_CHIP    1    // First MAX6921 chip
+#define VFD_GRID_G6_PIN     6    // OUT6
+
+// Segment distribution across MAX6921 chips
+// 실제 하드웨어 연결에 맞춘 정확한 매핑:
+// MAX6921 #1 (20비트): OUT0-OUT6 (G0-G6) + OUT7-OUT19 (S0-S12)
+// MAX6921 #2 (20비트): OUT0-OUT7 (S13-S20) + OUT8-OUT19 (사용안함)
+
+// 첫 번째 MAX6921의 데이터 구성
+#define VFD_MAX1_GRID_BITS        7      // G0-G6 (bit 0-6)
+#define VFD_MAX1_SEGMENT_BITS     13     // S0-S12 (bit 7-19)
+#define VFD_MAX1_GRID_MASK        0x0007F    // G0-G6 (bit 0-6)
+#define VFD_MAX1_SEGMENT_MASK     0x1FFF80   // S0-S12 (bit 7-19)
+
+// 두 번째 MAX6921의 데이터 구성  
+#define VFD_MAX2_SEGMENT_BITS     8      // S13-S20 (bit 0-7)
+#define VFD_MAX2_SEGMENT_MASK     0x0FF      // S13-S20 (bit 0-7)
+
+// Helper macros for segment mapping
+#define VFD_ALL_SEGMENTS_MAX1     VFD_MAX1_SEGMENT_MASK
+#define VFD_ALL_SEGMENTS_MAX2     VFD_MAX2_SEGMENT_MASK
+
+// Grid mask generation functions
+inline uint32_t getGridMask(int grid) {
+    if (grid < 0 || grid >= VFD_NUM_GRIDS) {
+        return 0;
+    }
+    return (1UL << grid);  // G0=bit0, G1=bit1, ..., G6=bit6
+}
+
+// Grid validation function
+inline bool isValidGrid(int grid) {
+    return (grid >= 0 && grid < VFD_NUM_GRIDS);
+}
+
+// Segment validation function
+inline bool isValidSegment(int segment) {
+    return (segment >= 0 && segment < VFD_NUM_SEGMENTS);
+}
+
+#endif // VFD_7BT317NK_CONFIG_H
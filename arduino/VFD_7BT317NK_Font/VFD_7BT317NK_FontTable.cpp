@@ -0,0 +1,53 @@
+/*
+ * VFD_7BT317NK_FontTable.cpp
+ * 
+ * Packed font tables for 7BT317NK VFD display (21 segments)
+ * 
+ * AUTO-GENERATED by tools/gen_font_table.py from vfd-configs/font-maps/7BT317NK/font-table.md
+ * 직접 수정하지 말고 폰트 표를 수정한 뒤 다시 생성할 것
+ */
+
+#include "VFD_7BT317NK_Font.h"
+
+#define PAT MAX6921_PACK_PATTERN
+
+// 문자 코드 (0x20 ~ 0x7F) → 21비트 패턴, 3바이트씩 (표에 없는 문자는 공백, 소문자는 대문자 패턴)
+const uint8_t VFD_7BT317NK_FONT_DENSE[96 * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {
+    PAT(0x000000), PAT(0x000000), PAT(0x000000), PAT(0x000000),  // ' ' '!' '"' '#'
+    PAT(0x000000), PAT(0x000000), PAT(0x000000), PAT(0x000000),  // '$' '%' '&' '\''
+    PAT(0x000000), PAT(0x000000), PAT(0x005750), PAT(0x002720),  // '(' ')' '*' '+'
+    PAT(0x000000), PAT(0x000700), PAT(0x100000), PAT(0x001240),  // ',' '-' '.' '/'
+    PAT(0x069942), PAT(0x088084), PAT(0x0E0F82), PAT(0x068682),  // '0' '1' '2' '3'
+    PAT(0x08878C), PAT(0x07870A), PAT(0x068F0A), PAT(0x08808A),  // '4' '5' '6' '7'
+    PAT(0x068F8A), PAT(0x08878A), PAT(0x100000), PAT(0x000000),  // '8' '9' ':' ';'
+    PAT(0x000000), PAT(0x000000), PAT(0x000000), PAT(0x000000),  // '<' '=' '>' '?'
+    PAT(0x000000), PAT(0x098F8A), PAT(0x06A6A2), PAT(0x06080A),  // '@' 'A' 'B' 'C'
+    PAT(0x06A2A2), PAT(0x070B0B), PAT(0x010B0F), PAT(0x068C0A),  // 'D' 'E' 'F' 'G'
+    PAT(0x098F8D), PAT(0x062222), PAT(0x068884), PAT(0x094B4D),  // 'H' 'I' 'J' 'K'
+    PAT(0x0F0809), PAT(0x098ADD), PAT(0x09CA9D), PAT(0x06888A),  // 'L' 'M' 'N' 'O'
+    PAT(0x010F8A), PAT(0x06C88A), PAT(0x094F8B), PAT(0x078616),  // 'P' 'Q' 'R' 'S'
+    PAT(0x042227), PAT(0x06888D), PAT(0x011A4D), PAT(0x09DA8D),  // 'T' 'U' 'V' 'W'
+    PAT(0x095255), PAT(0x042255), PAT(0x0F1747), PAT(0x000000),  // 'X' 'Y' 'Z' '['
+    PAT(0x000000), PAT(0x000000), PAT(0x000000), PAT(0x0F0000),  // '\\' ']' '^' '_'
+    PAT(0x000000), PAT(0x098F8A), PAT(0x06A6A2), PAT(0x06080A),  // '`' 'a' 'b' 'c'
+    PAT(0x06A2A2), PAT(0x070B0B), PAT(0x010B0F), PAT(0x068C0A),  // 'd' 'e' 'f' 'g'
+    PAT(0x098F8D), PAT(0x062222), PAT(0x068884), PAT(0x094B4D),  // 'h' 'i' 'j' 'k'
+    PAT(0x0F0809), PAT(0x098ADD), PAT(0x09CA9D), PAT(0x06888A),  // 'l' 'm' 'n' 'o'
+    PAT(0x010F8A), PAT(0x06C88A), PAT(0x094F8B), PAT(0x078616),  // 'p' 'q' 'r' 's'
+    PAT(0x042227), PAT(0x06888D), PAT(0x011A4D), PAT(0x09DA8D),  // 't' 'u' 'v' 'w'
+    PAT(0x095255), PAT(0x042255), PAT(0x0F1747), PAT(0x000000),  // 'x' 'y' 'z' '{'
+    PAT(0x000000), PAT(0x000000), PAT(0x000000), PAT(0x000000),  // '|' '}' '~' DEL
+};
+
+// 숫자 0-9 → 패턴
+const uint8_t VFD_7BT317NK_FONT_DIGITS[10 * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {
+    PAT(0x069942), PAT(0x088084), PAT(0x0E0F82), PAT(0x068682), PAT(0x08878C),  // 0-4
+    PAT(0x07870A), PAT(0x068F0A), PAT(0x08808A), PAT(0x068F8A), PAT(0x08878A)   // 5-9
+};
+
+// 문자 코드 (0x20 ~ 0x7F) → 지원 여부 (1비트/문자, bit n = 코드 0x20 + 8k + n)
+const uint8_t VFD_7BT317NK_FONT_SUPPORTED[12] PROGMEM = {
+    0x01, 0xEC, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0x07
+};
+
+#undef PAT
@@ -0,0 +1,49 @@
+/*
+ * VFD_7BT317NK_Map.h
+ * 
+ * MAX6921 chain output map for 7BT317NK VFD display
+ * 
+ * AUTO-GENERATED by tools/gen_output_map.py from vfd-configs/connection-tables/7BT317NK.json
+ * 직접 수정하지 말고 연결 테이블을 수정한 뒤 다시 생성할 것
+ */
+
+#ifndef VFD_7BT317NK_MAP_H
+#define VFD_7BT317NK_MAP_H
+
+#include <Arduino.h>
+
+#define VFD_7BT317NK_MAP_GRIDS        7
+#define VFD_7BT317NK_MAP_SEGMENTS     21
+#define VFD_7BT317NK_MAP_CHIPS        2
+#define VFD_7BT317NK_MAP_FRAME_BYTES  5
+
+// 그리드 Gn → 체인 비트
+constexpr uint8_t VFD_7BT317NK_GRID_CHAIN_BIT[7] PROGMEM = {
+    0, 1, 2, 3, 4, 5, 6
+};
+
+// 세그먼트 Pn → 체인 비트
+constexpr uint8_t VFD_7BT317NK_SEGMENT_CHAIN_BIT[21] PROGMEM = {
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27
+};
+
+// 그리드 Gn 선택 비트만 켜진 전송 프레임 (세그먼트는 인코딩 시 OR)
+constexpr uint8_t VFD_7BT317NK_GRID_FRAME[7][5] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x01 },  // G0
+    { 0x00, 0x00, 0x00, 0x00, 0x02 },  // G1
+    { 0x00, 0x00, 0x00, 0x00, 0x04 },  // G2
+    { 0x00, 0x00, 0x00, 0x00, 0x08 },  // G3
+    { 0x00, 0x00, 0x00, 0x00, 0x10 },  // G4
+    { 0x00, 0x00, 0x00, 0x00, 0x20 },  // G5
+    { 0x00, 0x00, 0x00, 0x00, 0x40 },  // G6
+};
+
+// 세그먼트 Pn → 전송 프레임 바이트 인덱스 / 비트 마스크
+constexpr uint8_t VFD_7BT317NK_SEGMENT_FRAME_BYTE[21] PROGMEM = {
+    4, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1
+};
+constexpr uint8_t VFD_7BT317NK_SEGMENT_FRAME_MASK[21] PROGMEM = {
+    0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08
+};
+
+#endif // VFD_7BT317NK_MAP_H
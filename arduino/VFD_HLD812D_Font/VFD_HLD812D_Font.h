@@ -0,0 +1,34 @@
+/*
+ * VFD_HLD812D_Font.h
+ * 
+ * Font table for HL-D812D VFD display (8 digits, 14-segment + center dot)
+ * Based on segment mapping from vfd-configs/font-maps/HLD812D/font-table.md
+ * 
+ * Segment Layout: P0-P15 (16 segments total, tube pins 1-16)
+ * Each pattern is stored as 3 packed bytes (bits 0-15 = segments P0-P15)
+ * (드라이버 프로필 폰트 형식, MAX6921_TubeProfile.h의 max6921ReadPattern으로 읽음)
+ * 
+ * 세그먼트 위치: P3 위, P7/P6 위 세로(왼/오), P4/P5 위 사선, P14 가운데 세로,
+ *               P9/P8 가운데 가로(왼/오), P11/P10 아래 세로, P12/P13 아래 사선, P15 아래, P1 가운데 점
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef VFD_HLD812D_FONT_H
+#define VFD_HLD812D_FONT_H
+
+#include <Arduino.h>
+#include "MAX6921_TubeProfile.h"
+
+#define VFD_HLD812D_FONT_FIRST_CHAR   0x20
+#define VFD_HLD812D_FONT_DENSE_SIZE   96
+
+// 플래시 조회 테이블 (튜브 프로필 VFD_HLD812D_PROFILE이 직접 참조)
+// font-table.md에서 tools/gen_font_table.py로 생성한 VFD_HLD812D_FontTable.cpp에 있음
+extern const uint8_t VFD_HLD812D_FONT_DENSE[VFD_HLD812D_FONT_DENSE_SIZE * MAX6921_FONT_PATTERN_BYTES];  // 문자 코드 0x20-0x7F → 패턴 (소문자는 대문자 패턴)
+extern const uint8_t VFD_HLD812D_FONT_DIGITS[10 * MAX6921_FONT_PATTERN_BYTES];                          // 숫자 0-9 → 패턴
+extern const uint8_t VFD_HLD812D_FONT_SUPPORTED[VFD_HLD812D_FONT_DENSE_SIZE / 8];                       // 문자 코드 0x20-0x7F → 지원 여부 (1비트/문자)
+
+#endif // VFD_HLD812D_FONT_H
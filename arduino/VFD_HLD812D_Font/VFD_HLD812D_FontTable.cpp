@@ -0,0 +1,53 @@
+/*
+ * VFD_HLD812D_FontTable.cpp
+ * 
+ * Packed font tables for HLD812D VFD display (16 segments)
+ * 
+ * AUTO-GENERATED by tools/gen_font_table.py from vfd-configs/font-maps/HLD812D/font-table.md
+ * 직접 수정하지 말고 폰트 표를 수정한 뒤 다시 생성할 것
+ */
+
+#include "VFD_HLD812D_Font.h"
+
+#define PAT MAX6921_PACK_PATTERN
+
+// 문자 코드 (0x20 ~ 0x7F) → 16비트 패턴, 3바이트씩 (표에 없는 문자는 공백, 소문자는 대문자 패턴)
+const uint8_t VFD_HLD812D_FONT_DENSE[96 * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {
+    PAT(0x0000), PAT(0x0000), PAT(0x0000), PAT(0x0000),  // ' ' '!' '"' '#'
+    PAT(0x0000), PAT(0x0000), PAT(0x0000), PAT(0x0000),  // '$' '%' '&' '\''
+    PAT(0x0000), PAT(0x0000), PAT(0x7330), PAT(0x4300),  // '(' ')' '*' '+'
+    PAT(0x0000), PAT(0x0300), PAT(0x0002), PAT(0x1020),  // ',' '-' '.' '/'
+    PAT(0x9CE8), PAT(0x0460), PAT(0x8B48), PAT(0x8548),  // '0' '1' '2' '3'
+    PAT(0x07C0), PAT(0x8788), PAT(0x8F88), PAT(0x0448),  // '4' '5' '6' '7'
+    PAT(0x8FC8), PAT(0x87C8), PAT(0x0002), PAT(0x0000),  // '8' '9' ':' ';'
+    PAT(0x0000), PAT(0x0000), PAT(0x0000), PAT(0x0000),  // '<' '=' '>' '?'
+    PAT(0x0000), PAT(0x0FC8), PAT(0xC548), PAT(0x8888),  // '@' 'A' 'B' 'C'
+    PAT(0xC448), PAT(0x8A88), PAT(0x0A88), PAT(0x8D88),  // 'D' 'E' 'F' 'G'
+    PAT(0x0FC0), PAT(0xC008), PAT(0x8C40), PAT(0x2AA0),  // 'H' 'I' 'J' 'K'
+    PAT(0x8880), PAT(0x0CF0), PAT(0x2CD0), PAT(0x8CC8),  // 'L' 'M' 'N' 'O'
+    PAT(0x0BC8), PAT(0xACC8), PAT(0x2BC8), PAT(0x8788),  // 'P' 'Q' 'R' 'S'
+    PAT(0x4008), PAT(0x8CC0), PAT(0x18A0), PAT(0x3CC0),  // 'T' 'U' 'V' 'W'
+    PAT(0x3030), PAT(0x43C0), PAT(0x9028), PAT(0x0000),  // 'X' 'Y' 'Z' '['
+    PAT(0x0000), PAT(0x0000), PAT(0x0000), PAT(0x8000),  // '\\' ']' '^' '_'
+    PAT(0x0000), PAT(0x0FC8), PAT(0xC548), PAT(0x8888),  // '`' 'a' 'b' 'c'
+    PAT(0xC448), PAT(0x8A88), PAT(0x0A88), PAT(0x8D88),  // 'd' 'e' 'f' 'g'
+    PAT(0x0FC0), PAT(0xC008), PAT(0x8C40), PAT(0x2AA0),  // 'h' 'i' 'j' 'k'
+    PAT(0x8880), PAT(0x0CF0), PAT(0x2CD0), PAT(0x8CC8),  // 'l' 'm' 'n' 'o'
+    PAT(0x0BC8), PAT(0xACC8), PAT(0x2BC8), PAT(0x8788),  // 'p' 'q' 'r' 's'
+    PAT(0x4008), PAT(0x8CC0), PAT(0x18A0), PAT(0x3CC0),  // 't' 'u' 'v' 'w'
+    PAT(0x3030), PAT(0x43C0), PAT(0x9028), PAT(0x0000),  // 'x' 'y' 'z' '{'
+    PAT(0x0000), PAT(0x0000), PAT(0x0000), PAT(0x0000),  // '|' '}' '~' DEL
+};
+
+// 숫자 0-9 → 패턴
+const uint8_t VFD_HLD812D_FONT_DIGITS[10 * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {
+    PAT(0x9CE8), PAT(0x0460), PAT(0x8B48), PAT(0x8548), PAT(0x07C0),  // 0-4
+    PAT(0x8788), PAT(0x8F88), PAT(0x0448), PAT(0x8FC8), PAT(0x87C8)   // 5-9
+};
+
+// 문자 코드 (0x20 ~ 0x7F) → 지원 여부 (1비트/문자, bit n = 코드 0x20 + 8k + n)
+const uint8_t VFD_HLD812D_FONT_SUPPORTED[12] PROGMEM = {
+    0x01, 0xEC, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0x07
+};
+
+#undef PAT
@@ -0,0 +1,50 @@
+/*
+ * VFD_HLD812D_Map.h
+ * 
+ * MAX6921 chain output map for HLD812D VFD display
+ * 
+ * AUTO-GENERATED by tools/gen_output_map.py from vfd-configs/connection-tables/HLD812D.json
+ * 직접 수정하지 말고 연결 테이블을 수정한 뒤 다시 생성할 것
+ */
+
+#ifndef VFD_HLD812D_MAP_H
+#define VFD_HLD812D_MAP_H
+
+#include <Arduino.h>
+
+#define VFD_HLD812D_MAP_GRIDS        8
+#define VFD_HLD812D_MAP_SEGMENTS     16
+#define VFD_HLD812D_MAP_CHIPS        2
+#define VFD_HLD812D_MAP_FRAME_BYTES  5
+
+// 그리드 Gn → 체인 비트
+constexpr uint8_t VFD_HLD812D_GRID_CHAIN_BIT[8] PROGMEM = {
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+// 세그먼트 Pn → 체인 비트
+constexpr uint8_t VFD_HLD812D_SEGMENT_CHAIN_BIT[16] PROGMEM = {
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23
+};
+
+// 그리드 Gn 선택 비트만 켜진 전송 프레임 (세그먼트는 인코딩 시 OR)
+constexpr uint8_t VFD_HLD812D_GRID_FRAME[8][5] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x01 },  // G0
+    { 0x00, 0x00, 0x00, 0x00, 0x02 },  // G1
+    { 0x00, 0x00, 0x00, 0x00, 0x04 },  // G2
+    { 0x00, 0x00, 0x00, 0x00, 0x08 },  // G3
+    { 0x00, 0x00, 0x00, 0x00, 0x10 },  // G4
+    { 0x00, 0x00, 0x00, 0x00, 0x20 },  // G5
+    { 0x00, 0x00, 0x00, 0x00, 0x40 },  // G6
+    { 0x00, 0x00, 0x00, 0x00, 0x80 },  // G7
+};
+
+// 세그먼트 Pn → 전송 프레임 바이트 인덱스 / 비트 마스크
+constexpr uint8_t VFD_HLD812D_SEGMENT_FRAME_BYTE[16] PROGMEM = {
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2
+};
+constexpr uint8_t VFD_HLD812D_SEGMENT_FRAME_MASK[16] PROGMEM = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+#endif // VFD_HLD812D_MAP_H
@@ -0,0 +1,440 @@
+/*
+ * Benchmark.ino
+ *
+ * MAX6921 VFD 드라이버 스캔 비용 측정
+ *
+ * 멀티플렉싱이 CPU를 얼마나 쓰는지 단계별로 측정하여 시리얼로 CSV 출력
+ * (버전 간 비교용: 출력 전체를 파일로 저장해 두고 diff)
+ *
+ *   benchmark,param,iterations,total_us,per_op_ns
+ *
+ * 측정 항목:
+ * - font_lookup   : 문자 → 세그먼트 패턴 조회
+ * - draw_present  : 7글자 문자열 그리기 + 그리드 인코딩 + present()
+ * - draw_glyph    : 같은 측정을 사용자 글리프 7글자(UTF-8 2바이트 문자)로 (draw_present와 비교)
+ * - number_snprintf : 기존 방식 snprintf("%7ld") + displayString() (비교용)
+ * - number_direct   : displayNumber(long) (숫자 전용 테이블로 그리드 마스크 직접 생성)
+ * - fixed_direct    : displayFixed(value, 2)
+ * - float_dtostrf   : dtostrf() + displayString() (비교용, AVR)
+ * - float_direct    : displayFloat(value, 2)
+ * - bitmap_upload : 전체 그리드 비트맵 setFrame() + 인코딩 + present() (param 0 = RAM, 1 = PROGMEM)
+ * - bitmap_stream : 시리얼 프로토콜 GRIDS 프레임 해석 + bitmap_upload (param = 프레임 바이트)
+ * - transfer      : 체인 프레임 전송 + LOAD (SPI 클록 x 칩 수별)
+ * - transfer_async: 비동기 SPI 전송 시 send() 호출이 CPU를 점유하는 시간 (같은 파라미터)
+ * - transfer_gpio : 포트 레지스터 비트뱅 전송 (param = 칩 수)
+ * - transfer_digitalwrite : 기존 TEST.ino 방식 digitalWrite + delayMicroseconds(2) 비트뱅 (비교용)
+ * - load_toggle   : LOAD 핀 LOW/HIGH 1회
+ * - blank_toggle  : BLANK 핀 HIGH/LOW 1회
+ * - grid_scan     : refresh() 1회 = 그리드 1개 스캔 (BLANK + 전송 + LOAD)
+ * - frame_scan    : 그리드 수별 화면 1장 스캔 추정 (grid_scan x 그리드 수)
+ *
+ * 메모리 사용량 (SRAM 바이트, 컴파일 타임 크기):
+ *
+ *   sizeof,object,bytes
+ *
+ * 폰트/튜브 프로필 플래시 사용량 (PROGMEM 바이트, SRAM은 쓰지 않음)
+ *
+ *   flash,object,bytes
+ *
+ * 전체 비트맵 스트리밍 최대 화면 수 (초당, source = ram / progmem / protocol / wire_115200)
+ * wire_115200은 115200보에서 GRIDS 프레임을 연속으로 받을 때의 한계
+ *
+ *   bitmap_fps,source,frames_per_s
+ *
+ * 이어서 그리드 주기별 스캔 CPU 점유율을 별도 표로 출력 (0.01% 단위)
+ *
+ *   cpu_load,grid_period_us,permyriad
+ *
+ * 드라이버 내부 단계별 측정(ISR 포함)은 MAX6921_VFD_Driver.h의
+ * MAX6921_PROFILE을 켜면 추가로 출력됨
+ *
+ * 하드웨어 연결은 TEST 예제와 동일 (D11 DIN, D13 CLK, D10 LOAD, D9 BLANK)
+ * 측정 중에는 BLANK를 켜 두므로 화면에 잔상이 남지 않음
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "VFD_7BT317NK_Config.h"
+#include <MAX6921_VFD_Driver.h>
+#include <MAX6921_GPIOTransport.h>
+#include <MAX6921_SerialProtocol.h>
+#include <VFD_7BT317NK_Font.h>
+
+#define DEFAULT_LOAD_PIN    10   // Common LOAD pin for all MAX6921 chips
+#define DEFAULT_BLANK_PIN   9    // Common BLANK pin for all MAX6921 chips
+#define DEFAULT_DIN_PIN     11   // 하드웨어 SPI MOSI (비트뱅 측정 시 GPIO로 사용)
+#define DEFAULT_CLK_PIN     13   // 하드웨어 SPI SCK
+
+#define BENCH_ITERATIONS    1000
+
+MAX6921_VFD_Driver vfd(DEFAULT_LOAD_PIN, DEFAULT_BLANK_PIN,
+                       VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+
+// 측정 대상 SPI 클록 / 그리드 주기 / 그리드 수
+const uint32_t SPI_CLOCKS[] = { 1000000, 2000000, 4000000, 8000000 };
+const uint16_t GRID_PERIODS_US[] = { 500, 1000, 2000, 4000 };
+const uint8_t GRID_COUNTS[] = { 4, 7, 8, 12, 16 };
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+// 비트맵 측정용 화면 2장 (번갈아 올려 매번 모든 그리드가 바뀌도록 함)
+const VFD_SegmentMask BITMAP_FRAMES_P[2][VFD_NUM_GRIDS] PROGMEM = {
+  { 0x000001, 0x000002, 0x000004, 0x000008, 0x000010, 0x000020, 0x000040 },
+  { 0x1FFFFE, 0x1FFFFD, 0x1FFFFB, 0x1FFFF7, 0x1FFFEF, 0x1FFFDF, 0x1FFFBF },
+};
+
+MAX6921_SerialProtocol protocol(&vfd);
+
+volatile uint32_t benchSink;  // 컴파일러가 측정 루프를 제거하지 않도록
+
+void printResult(const char* name, uint32_t param, uint32_t iterations, uint32_t totalUs) {
+  Serial.print(name);
+  Serial.print(',');
+  Serial.print(param);
+  Serial.print(',');
+  Serial.print(iterations);
+  Serial.print(',');
+  Serial.print(totalUs);
+  Serial.print(',');
+  Serial.println((uint32_t)((uint64_t)totalUs * 1000 / iterations));
+}
+
+void benchFontLookup() {
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    benchSink = getCharacterPattern((char)(' ' + (i % 96)));
+  }
+  printResult("font_lookup", 0, BENCH_ITERATIONS, micros() - start);
+}
+
+void benchDrawPresent() {
+  // 두 문자열을 번갈아 그려 매번 7개 그리드 모두 다시 인코딩되도록 함
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.displayString((i & 1) ? "8888888" : "1234567");
+  }
+  printResult("draw_present", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+}
+
+void benchGlyphDraw() {
+  // '°'(U+00B0)를 사용자 글리프로 등록하고 draw_present와 같은 방식으로 번갈아 그림
+  vfd.defineGlyph(0xB0, getCharacterPattern('O'));
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.displayString((i & 1) ? "\u00B0\u00B0\u00B0\u00B0\u00B0\u00B0\u00B0" : "1234567");
+  }
+  printResult("draw_glyph", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+  vfd.clearGlyphs();
+}
+
+// 숫자 표시: 매번 여러 자리가 바뀌도록 값을 흩뿌림 (param = 표시 자릿수)
+long benchNumberValue(uint16_t i) {
+  return (long)((i * 7919UL) % 1000000UL) - 500000L;
+}
+
+void benchNumberFormat() {
+  char buffer[16];
+
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    snprintf(buffer, sizeof(buffer), "%7ld", benchNumberValue(i));
+    vfd.displayString(buffer);
+  }
+  printResult("number_snprintf", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.displayNumber(benchNumberValue(i));
+  }
+  printResult("number_direct", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.displayFixed(benchNumberValue(i), 2);
+  }
+  printResult("fixed_direct", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+
+#if defined(__AVR__)
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    dtostrf(benchNumberValue(i) / 100.0f, 7, 2, buffer);
+    vfd.displayString(buffer);
+  }
+  printResult("float_dtostrf", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+#endif
+
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.displayFloat(benchNumberValue(i) / 100.0f, 2);
+  }
+  printResult("float_direct", VFD_NUM_GRIDS, BENCH_ITERATIONS, micros() - start);
+}
+
+// 반환값: 화면 1장당 ns
+uint32_t benchBitmapUpload(bool progmem) {
+  VFD_SegmentMask frames[2][VFD_NUM_GRIDS];
+  memcpy_P(frames, BITMAP_FRAMES_P, sizeof(frames));
+
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    if (progmem) {
+      vfd.setFrame_P(BITMAP_FRAMES_P[i & 1]);
+    } else {
+      vfd.setFrame(frames[i & 1]);
+    }
+  }
+  uint32_t totalUs = micros() - start;
+  printResult("bitmap_upload", progmem ? 1 : 0, BENCH_ITERATIONS, totalUs);
+  return (uint32_t)((uint64_t)totalUs * 1000 / BENCH_ITERATIONS);
+}
+
+// GRIDS 프레임 (0xA5 | CMD | LEN | first | 마스크 x 그리드 | CRC8)
+uint8_t buildGridsFrame(uint8_t* out, const VFD_SegmentMask* masks) {
+  uint8_t length = 1 + VFD_NUM_GRIDS * MAX6921_PROTO_GRID_BYTES;
+  uint8_t n = 0;
+  out[n++] = MAX6921_PROTO_SYNC;
+  out[n++] = MAX6921_CMD_GRIDS;
+  out[n++] = length;
+  out[n++] = 0;
+  for (uint8_t g = 0; g < VFD_NUM_GRIDS; g++) {
+    for (uint8_t b = 0; b < MAX6921_PROTO_GRID_BYTES; b++) {
+      out[n++] = (uint8_t)(masks[g] >> (8 * b));
+    }
+  }
+  uint8_t crc = 0;
+  for (uint8_t i = 1; i < n; i++) crc = MAX6921_SerialProtocol::crc8(crc, out[i]);
+  out[n++] = crc;
+  return n;
+}
+
+// 반환값: 화면 1장당 ns (UART 수신 시간 제외)
+uint32_t benchBitmapStream(uint8_t* frameBytes) {
+  VFD_SegmentMask frames[2][VFD_NUM_GRIDS];
+  memcpy_P(frames, BITMAP_FRAMES_P, sizeof(frames));
+
+  uint8_t encoded[2][4 + VFD_NUM_GRIDS * MAX6921_PROTO_GRID_BYTES + 1];
+  uint8_t length = buildGridsFrame(encoded[0], frames[0]);
+  buildGridsFrame(encoded[1], frames[1]);
+
+  protocol.setAck(false);
+  protocol.setLineMode(false);
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    for (uint8_t b = 0; b < length; b++) {
+      protocol.write(encoded[i & 1][b]);
+    }
+    protocol.process();
+  }
+  uint32_t totalUs = micros() - start;
+  printResult("bitmap_stream", length, BENCH_ITERATIONS, totalUs);
+  *frameBytes = length;
+  return (uint32_t)((uint64_t)totalUs * 1000 / BENCH_ITERATIONS);
+}
+
+void printBitmapFps(const char* source, uint32_t perFrameNs) {
+  Serial.print("bitmap_fps,");
+  Serial.print(source);
+  Serial.print(',');
+  Serial.println(perFrameNs ? 1000000000UL / perFrameNs : 0);
+}
+
+// param = SPI 클록(kHz) x 100 + 칩 수
+void benchTransfer() {
+  uint8_t frame[MAX6921_CHAIN_BYTES(4)] = {0};
+
+  for (uint8_t c = 0; c < ARRAY_SIZE(SPI_CLOCKS); c++) {
+    MAX6921_SPITransport transport(DEFAULT_LOAD_PIN, SPI_CLOCKS[c]);
+    transport.begin();
+
+    for (uint8_t chips = 1; chips <= 4; chips++) {
+      uint32_t start = micros();
+      for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+        transport.send(frame, MAX6921_CHAIN_BYTES(chips));
+      }
+      printResult("transfer", SPI_CLOCKS[c] / 1000 * 100 + chips, BENCH_ITERATIONS, micros() - start);
+    }
+  }
+}
+
+// send() 반환까지의 시간만 누적 (나머지 바이트는 SPI 인터럽트에서 전송)
+void benchTransferAsync() {
+  uint8_t frame[MAX6921_CHAIN_BYTES(4)] = {0};
+
+  for (uint8_t c = 0; c < ARRAY_SIZE(SPI_CLOCKS); c++) {
+    MAX6921_AsyncSPITransport transport(DEFAULT_LOAD_PIN, SPI_CLOCKS[c]);
+    transport.begin();
+
+    for (uint8_t chips = 1; chips <= 4; chips++) {
+      uint32_t totalUs = 0;
+      for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+        uint32_t start = micros();
+        transport.send(frame, MAX6921_CHAIN_BYTES(chips));
+        totalUs += micros() - start;
+        while (transport.isBusy()) {
+        }
+      }
+      printResult("transfer_async", SPI_CLOCKS[c] / 1000 * 100 + chips, BENCH_ITERATIONS, totalUs);
+    }
+  }
+}
+
+// TEST.ino의 주석 처리된 sendAllData()와 같은 방식 (에지마다 2us 지연)
+void sendDigitalWrite(const uint8_t* frame, uint8_t length) {
+  digitalWrite(DEFAULT_LOAD_PIN, LOW);
+  delayMicroseconds(1);
+
+  for (uint8_t i = 0; i < length; i++) {
+    for (int8_t bit = 7; bit >= 0; bit--) {
+      digitalWrite(DEFAULT_DIN_PIN, (frame[i] >> bit) & 1);
+      digitalWrite(DEFAULT_CLK_PIN, HIGH);
+      delayMicroseconds(2);
+      digitalWrite(DEFAULT_CLK_PIN, LOW);
+      delayMicroseconds(2);
+    }
+  }
+
+  digitalWrite(DEFAULT_LOAD_PIN, HIGH);
+  delayMicroseconds(5);
+}
+
+// 비트뱅 전송 비교 (측정 동안 하드웨어 SPI를 꺼서 DIN/CLK 핀을 GPIO로 사용)
+void benchTransferGPIO() {
+  uint8_t frame[MAX6921_CHAIN_BYTES(4)] = {0};
+  MAX6921_GPIOTransport<DEFAULT_DIN_PIN, DEFAULT_CLK_PIN, DEFAULT_LOAD_PIN> transport;
+
+  SPI.end();
+  transport.begin();
+
+  for (uint8_t chips = 1; chips <= 4; chips++) {
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+      transport.send(frame, MAX6921_CHAIN_BYTES(chips));
+    }
+    printResult("transfer_gpio", chips, BENCH_ITERATIONS, micros() - start);
+  }
+
+  // digitalWrite 방식은 느리므로 반복 횟수를 1/10로 줄임
+  for (uint8_t chips = 1; chips <= 4; chips++) {
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_ITERATIONS / 10; i++) {
+      sendDigitalWrite(frame, MAX6921_CHAIN_BYTES(chips));
+    }
+    printResult("transfer_digitalwrite", chips, BENCH_ITERATIONS / 10, micros() - start);
+  }
+
+  SPI.begin();
+}
+
+void benchPinToggle(const char* name, uint8_t pin, uint8_t idle) {
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    digitalWrite(pin, !idle);
+    digitalWrite(pin, idle);
+  }
+  printResult(name, pin, BENCH_ITERATIONS, micros() - start);
+}
+
+// 그리드 주기 0 = refresh()마다 그리드 1개 스캔
+uint32_t benchGridScan() {
+  vfd.setGridScanDelay(0);
+
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    vfd.refresh();
+  }
+  uint32_t totalUs = micros() - start;
+  printResult("grid_scan", VFD_NUM_GRIDS, BENCH_ITERATIONS, totalUs);
+
+  vfd.setGridScanDelay(DEFAULT_GRID_SCAN_DELAY_US);
+  return totalUs;
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("=== MAX6921 VFD Driver Benchmark ===");
+  Serial.print("version,");
+  Serial.println(vfd.getVersion());
+  Serial.print("f_cpu,");
+  Serial.println(F_CPU);
+
+  vfd.begin();
+  vfd.setBrightness(0);  // 측정 중 화면 끔 (BLANK 유지)
+
+  // 드라이버 SRAM 사용량 (플래시 크기는 빌드 출력 참조)
+  Serial.println("sizeof,object,bytes");
+  Serial.print("sizeof,driver,");
+  Serial.println(sizeof(vfd));
+  Serial.print("sizeof,grid_store,");
+  Serial.println(sizeof(VFD_GridStore));
+  Serial.print("sizeof,segment_mask,");
+  Serial.println(sizeof(VFD_SegmentMask));
+  Serial.print("sizeof,frame_buffer,");
+  Serial.println(sizeof(MAX6921_FrameBuffer));
+
+  // 폰트 테이블은 패턴당 3바이트로 플래시에만 있음 (조회는 max6921ReadPattern)
+  Serial.println("flash,object,bytes");
+  Serial.print("flash,font_dense,");
+  Serial.println(sizeof(VFD_7BT317NK_FONT_DENSE));
+  Serial.print("flash,font_digits,");
+  Serial.println(sizeof(VFD_7BT317NK_FONT_DIGITS));
+  Serial.print("flash,tube_profile,");
+  Serial.println(sizeof(MAX6921_TubeProfile));
+
+  Serial.println("benchmark,param,iterations,total_us,per_op_ns");
+
+  benchFontLookup();
+  benchDrawPresent();
+  benchGlyphDraw();
+  benchNumberFormat();
+  uint32_t bitmapRamNs = benchBitmapUpload(false);
+  uint32_t bitmapProgmemNs = benchBitmapUpload(true);
+  uint8_t streamFrameBytes;
+  uint32_t bitmapStreamNs = benchBitmapStream(&streamFrameBytes);
+  benchTransfer();
+  benchTransferAsync();
+  benchTransferGPIO();
+  benchPinToggle("load_toggle", DEFAULT_LOAD_PIN, HIGH);
+  benchPinToggle("blank_toggle", DEFAULT_BLANK_PIN, HIGH);
+
+  uint32_t gridScanUs = benchGridScan();
+
+  // 그리드 수별 화면 1장 추정 (칩 수가 같을 때 그리드 비용은 그리드 수와 무관)
+  for (uint8_t g = 0; g < ARRAY_SIZE(GRID_COUNTS); g++) {
+    printResult("frame_scan", GRID_COUNTS[g], BENCH_ITERATIONS, gridScanUs * GRID_COUNTS[g]);
+  }
+
+  // 전체 비트맵 스트리밍 최대 화면 수 (바이트당 10비트)
+  Serial.println("bitmap_fps,source,frames_per_s");
+  printBitmapFps("ram", bitmapRamNs);
+  printBitmapFps("progmem", bitmapProgmemNs);
+  printBitmapFps("protocol", bitmapStreamNs);
+  printBitmapFps("wire_115200", (uint32_t)(streamFrameBytes * 10 * 1000000000ULL / 115200));
+
+  // 그리드 주기별 CPU 점유율 (0.01% 단위)
+  Serial.println("cpu_load,grid_period_us,permyriad");
+  for (uint8_t p = 0; p < ARRAY_SIZE(GRID_PERIODS_US); p++) {
+    Serial.print("cpu_load,");
+    Serial.print(GRID_PERIODS_US[p]);
+    Serial.print(',');
+    Serial.println((uint32_t)((uint64_t)gridScanUs * 10000 / BENCH_ITERATIONS / GRID_PERIODS_US[p]));
+  }
+
+#ifdef MAX6921_PROFILE
+  // 타이머(또는 폴링) 스캔 1초 동안 드라이버 내부 단계별 측정
+  vfd.resetProfile();
+  vfd.setBrightness(VFD_MAX_BRIGHTNESS);
+  vfd.displayString("8888888");
+  bool timerScan = vfd.beginTimerScan();
+  uint32_t start = millis();
+  while (millis() - start < 1000) {
+    vfd.refresh();
+  }
+  if (timerScan) vfd.endTimerScan();
+  vfd.printProfileCSV();
+#endif
+
+  Serial.println("=== done ===");
+}
+
+void loop() {
+}
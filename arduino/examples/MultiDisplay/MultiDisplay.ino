@@ -0,0 +1,109 @@
+/*
+ * MultiDisplay.ino
+ *
+ * VFD 여러 개를 SPI 버스 하나와 스캔 틱 하나로 구동 (MAX6921_DisplayManager)
+ *
+ * 하드웨어 연결:
+ * - Arduino D11 → 모든 MAX6921 체인 DIN
+ * - Arduino D13 → 모든 MAX6921 체인 CLK
+ * - Arduino D9  → 모든 MAX6921 체인 BLANK
+ * - LOAD_PINS[] → 디스플레이별 LOAD
+ *
+ * 1초마다 디스플레이별 초당 그리드 스캔 수와 화면 주사율을 시리얼로 출력
+ *
+ *   displays,per_tick,tick_hz,display,grid_scans_per_s,frame_hz
+ *
+ * NUM_DISPLAYS(1-8)와 MAX_PER_TICK을 바꿔 가며 비교
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "VFD_7BT317NK_Config.h"
+#include <MAX6921_VFD_Driver.h>
+#include <MAX6921_DisplayManager.h>
+
+#define DEFAULT_BLANK_PIN   9    // Common BLANK pin for all displays
+#define NUM_DISPLAYS        4
+#define MAX_PER_TICK        0    // 0 = 매 틱 모든 디스플레이 스캔
+
+const uint8_t LOAD_PINS[MAX6921_MANAGER_MAX_DISPLAYS] = { 10, 8, 7, 6, 5, 4, 3, 2 };
+
+// 드라이버 인스턴스는 프레임 버퍼만 사용 (BLANK는 관리자가 구동)
+MAX6921_VFD_Driver displays[NUM_DISPLAYS] = {
+#if NUM_DISPLAYS > 0
+  MAX6921_VFD_Driver(LOAD_PINS[0], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 1
+  MAX6921_VFD_Driver(LOAD_PINS[1], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 2
+  MAX6921_VFD_Driver(LOAD_PINS[2], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 3
+  MAX6921_VFD_Driver(LOAD_PINS[3], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 4
+  MAX6921_VFD_Driver(LOAD_PINS[4], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 5
+  MAX6921_VFD_Driver(LOAD_PINS[5], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 6
+  MAX6921_VFD_Driver(LOAD_PINS[6], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+#if NUM_DISPLAYS > 7
+  MAX6921_VFD_Driver(LOAD_PINS[7], DEFAULT_BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS),
+#endif
+};
+
+MAX6921_DisplayManager manager(DEFAULT_BLANK_PIN, VFD_MAX_BRIGHTNESS);
+
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("=== MAX6921 Multi Display ===");
+
+  for (uint8_t i = 0; i < NUM_DISPLAYS; i++) {
+    manager.addDisplay(&displays[i]);
+
+    char text[VFD_NUM_GRIDS + 1];
+    memset(text, '0' + i, VFD_NUM_GRIDS);
+    text[VFD_NUM_GRIDS] = '\0';
+    displays[i].displayString(text);
+  }
+
+  manager.setMaxDisplaysPerTick(MAX_PER_TICK);
+  manager.begin();
+
+  Serial.println("displays,per_tick,tick_hz,display,grid_scans_per_s,frame_hz");
+  lastReport = millis();
+}
+
+void loop() {
+  manager.refresh();
+
+  unsigned long now = millis();
+  if (now - lastReport >= 1000) {
+    uint32_t elapsedMs = now - lastReport;
+    uint32_t tickHz = manager.getTickCount() * 1000UL / elapsedMs;
+
+    for (uint8_t i = 0; i < NUM_DISPLAYS; i++) {
+      uint32_t scansPerSecond = manager.getScanCount(i) * 1000UL / elapsedMs;
+      Serial.print(NUM_DISPLAYS);
+      Serial.print(',');
+      Serial.print(MAX_PER_TICK);
+      Serial.print(',');
+      Serial.print(tickHz);
+      Serial.print(',');
+      Serial.print(i);
+      Serial.print(',');
+      Serial.print(scansPerSecond);
+      Serial.print(',');
+      Serial.println(scansPerSecond / VFD_NUM_GRIDS);
+    }
+
+    manager.resetStats();
+    lastReport = millis();
+  }
+}
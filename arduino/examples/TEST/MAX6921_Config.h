@@ -0,0 +1,62 @@
+/*
+ * MAX6921_Config.h
+ *
+ * 드라이버 기본 설정 (라이브러리 소스가 포함하는 유일한 튜브 설정 진입점)
+ *
+ * 라이브러리 .cpp는 스케치와 따로 컴파일되므로, 기본 튜브(begin()에 프로필을 넘기지 않을 때)의
+ * 크기와 출력 맵은 이 헤더가 고른 튜브 설정 파일에서 가져온다.
+ * 실행 중 튜브 선택은 begin(&PROFILE) / setTubeProfile()로 한다 (MAX6921_TubeProfile.h 참조).
+ *
+ * 다른 튜브를 기본으로 쓰려면 빌드 플래그로 설정 헤더를 지정:
+ *   -DMAX6921_TUBE_CONFIG=\"VFD_xxx_Config.h\"
+ *
+ * 튜브 설정 헤더가 정의해야 하는 것:
+ *   VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS, VFD_DEFAULT_PROFILE,
+ *   VFD_MAP_FRAME_BYTES, VFD_GRID_CHAIN_BIT, VFD_SEGMENT_CHAIN_BIT
+ *
+ * 드라이버 저장소 용량(VFD_MAX_GRIDS/SEGMENTS/FRAME_BYTES)은 튜브와 무관한 라이브러리 설정으로
+ * 여기서 정한다. 더 큰 프로필을 쓰려면 빌드 플래그로 덮어씀:
+ *   -DVFD_MAX_GRIDS=16 -DVFD_MAX_SEGMENTS=32 -DVFD_MAX_FRAME_BYTES=10
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_CONFIG_H
+#define MAX6921_CONFIG_H
+
+#ifndef MAX6921_TUBE_CONFIG
+#define MAX6921_TUBE_CONFIG "VFD_7BT317NK_Config.h"
+#endif
+
+#include MAX6921_TUBE_CONFIG
+
+// 드라이버 저장소 용량: begin()에 넘길 수 있는 가장 큰 프로필 기준 (컴파일 타임 고정)
+// 기본값은 동봉된 프로필(7BT317NK 7x21, HL-D812D 8x16, 2칩 체인)을 모두 담는 크기이며
+// 기본 튜브가 더 크면 그 크기를 따름. 실제 그리드/세그먼트 수는 begin() 시 프로필이 정함
+#ifndef VFD_MAX_GRIDS
+#if VFD_NUM_GRIDS > 8
+#define VFD_MAX_GRIDS         VFD_NUM_GRIDS
+#else
+#define VFD_MAX_GRIDS         8
+#endif
+#endif
+
+#ifndef VFD_MAX_SEGMENTS
+#if VFD_NUM_SEGMENTS > 21
+#define VFD_MAX_SEGMENTS      VFD_NUM_SEGMENTS
+#else
+#define VFD_MAX_SEGMENTS      21
+#endif
+#endif
+
+#ifndef VFD_MAX_FRAME_BYTES
+#if VFD_MAP_FRAME_BYTES > 5
+#define VFD_MAX_FRAME_BYTES   VFD_MAP_FRAME_BYTES
+#else
+#define VFD_MAX_FRAME_BYTES   5
+#endif
+#endif
+
+#endif // MAX6921_CONFIG_H
@@ -0,0 +1,237 @@
+/*
+ * MAX6921_DisplayManager.cpp
+ *
+ * Implementation file for multi-display scan manager
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_DisplayManager.h"
+
+MAX6921_DisplayManager::MAX6921_DisplayManager(uint8_t blankPin, uint8_t maxBrightness)
+    : _settings(DEFAULT_SPI_CLOCK_SPEED, MSBFIRST, SPI_MODE0) {
+    _count = 0;
+    _nextDisplay = 0;
+    _maxPerTick = 0;
+    _blankPin = blankPin;
+    _clockSpeed = DEFAULT_SPI_CLOCK_SPEED;
+    _blanked = false;
+    _brightness = maxBrightness;
+    _maxBrightness = maxBrightness;
+    _gridPeriodUs = DEFAULT_GRID_SCAN_DELAY_US;
+    _blankLeadUs = DEFAULT_BLANK_LEAD_US;
+    _blankTrailUs = DEFAULT_BLANK_TRAIL_US;
+    _displayTransferUs = 0;
+    _measuredTransferUs = 0;
+    _phase = 0;
+    _latchTime = 0;
+    _lastTick = 0;
+    _tickCount = 0;
+    updateOnTime();
+}
+
+bool MAX6921_DisplayManager::addDisplay(MAX6921_VFD_Driver* display) {
+    if (display == NULL || _count >= MAX6921_MANAGER_MAX_DISPLAYS) return false;
+
+    Entry& entry = _displays[_count++];
+    entry.display = display;
+    entry.loadPin = display->getLoadPin();
+    entry.scanCount = 0;
+    estimateTransferTime();
+    return true;
+}
+
+uint8_t MAX6921_DisplayManager::getDisplayCount() {
+    return _count;
+}
+
+void MAX6921_DisplayManager::begin(uint32_t spiClockSpeed) {
+    if (spiClockSpeed > MAX6921_MAX_SPI_CLOCK) spiClockSpeed = MAX6921_MAX_SPI_CLOCK;
+    _settings = SPISettings(spiClockSpeed, MSBFIRST, SPI_MODE0);
+    _clockSpeed = spiClockSpeed;
+    _measuredTransferUs = 0;
+    estimateTransferTime();
+
+    pinMode(_blankPin, OUTPUT);
+    setBlank(true);
+
+    // 공유 버스에서는 LOAD 평상시 LOW (래치 고정)
+    for (uint8_t i = 0; i < _count; i++) {
+        pinMode(_displays[i].loadPin, OUTPUT);
+        digitalWrite(_displays[i].loadPin, LOW);
+    }
+
+    SPI.begin();
+    _lastTick = micros();
+}
+
+// 폴링 모드 틱: 드라이버 refresh()와 같은 그리드 슬롯 구성 (lead/trail 대기는 다음 호출에서 이어감)
+void MAX6921_DisplayManager::refresh() {
+    unsigned long currentTime = micros();
+    unsigned long elapsed = currentTime - _lastTick;
+
+    if (elapsed >= _gridPeriodUs) {
+        setBlank(true);
+        _lastTick = currentTime;
+        _phase = 1;
+        elapsed = 0;
+
+        // 측정한 전송 시간이 추정보다 길면 BLANK 예약을 늘림 (줄이지는 않음)
+        if (_measuredTransferUs > _displayTransferUs) {
+            _displayTransferUs = _measuredTransferUs;
+            updateOnTime();
+        }
+    }
+
+    if (_phase == 1) {
+        if (elapsed < _blankLeadUs) return;
+        scanTick();
+        _latchTime = micros();
+        _phase = 2;
+    }
+
+    if (_phase == 2) {
+        if ((unsigned long)(micros() - _latchTime) < _blankTrailUs) return;
+        _phase = 0;
+        if (_onTimeUs > 0) {
+            setBlank(false);
+        }
+        updateEffects();                  // 표시 구간에 진행
+    } else if (!_blanked && (unsigned long)(micros() - _latchTime) >= (unsigned long)_blankTrailUs + _onTimeUs) {
+        // 표시 구간은 마지막 LOAD 시각부터 (전송 시간만큼 표시 시간이 줄지 않게)
+        setBlank(true);
+    }
+}
+
+void MAX6921_DisplayManager::updateEffects() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _displays[i].display->effects().update();
+    }
+}
+
+// 등록된 디스플레이를 한 번의 SPI 트랜잭션으로 스캔 (BLANK는 호출한 쪽에서 제어)
+void MAX6921_DisplayManager::scanTick() {
+    uint8_t count = _count;
+    if (count == 0) return;
+
+    uint8_t perTick = displaysPerTick();
+    uint8_t index = _nextDisplay;
+    if (index >= count) index = 0;
+
+    unsigned long start = micros();
+    SPI.beginTransaction(_settings);
+
+    for (uint8_t n = 0; n < perTick; n++) {
+        Entry& entry = _displays[index];
+        const uint8_t* frame = entry.display->advanceScan();
+        uint8_t frameBytes = entry.display->getFrameBytes();  // 디스플레이마다 튜브 프로필이 다를 수 있음
+
+        for (uint8_t i = 0; i < frameBytes; i++) {
+            SPI.transfer(frame[i]);
+        }
+
+        // 이 체인에만 래치 (다른 체인은 LOAD LOW로 직전 그리드 유지)
+        digitalWrite(entry.loadPin, HIGH);
+        digitalWrite(entry.loadPin, LOW);
+        entry.scanCount++;
+
+        if (++index >= count) index = 0;
+    }
+
+    SPI.endTransaction();
+
+    uint16_t perDisplay = (uint16_t)((micros() - start + perTick - 1) / perTick);
+    if (perDisplay > _measuredTransferUs) _measuredTransferUs = perDisplay;
+
+    _nextDisplay = index;
+    _tickCount++;
+}
+
+// BLANK 핀 제어 (BLANK는 active high: HIGH = 모든 출력 끔)
+void MAX6921_DisplayManager::setBlank(bool blank) {
+    digitalWrite(_blankPin, blank ? HIGH : LOW);
+    _blanked = blank;
+}
+
+void MAX6921_DisplayManager::setMaxDisplaysPerTick(uint8_t count) {
+    _maxPerTick = count;
+    updateOnTime();
+}
+
+uint8_t MAX6921_DisplayManager::displaysPerTick() {
+    return (_maxPerTick == 0 || _maxPerTick > _count) ? _count : _maxPerTick;
+}
+
+void MAX6921_DisplayManager::setGridPeriod(uint16_t periodUs) {
+    _gridPeriodUs = periodUs;
+    updateOnTime();
+}
+
+void MAX6921_DisplayManager::setBlankGuard(uint16_t leadUs, uint16_t trailUs) {
+    _blankLeadUs = leadUs;
+    _blankTrailUs = trailUs;
+    updateOnTime();
+}
+
+uint16_t MAX6921_DisplayManager::getGridPeriod() {
+    return _gridPeriodUs;
+}
+
+void MAX6921_DisplayManager::setBrightness(uint8_t brightness) {
+    if (brightness > _maxBrightness) brightness = _maxBrightness;
+    _brightness = brightness;
+    updateOnTime();
+}
+
+uint8_t MAX6921_DisplayManager::getBrightness() {
+    return _brightness;
+}
+
+uint16_t MAX6921_DisplayManager::getOnTimeUs() {
+    return _onTimeUs;
+}
+
+uint16_t MAX6921_DisplayManager::getTransferTimeUs() {
+    return _displayTransferUs;
+}
+
+// 디스플레이 1개 전송 시간 추정: 가장 큰 프레임의 비트 수 / SPI 클록 (올림)
+void MAX6921_DisplayManager::estimateTransferTime() {
+    uint8_t maxBytes = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        uint8_t bytes = _displays[i].display->getFrameBytes();
+        if (bytes > maxBytes) maxBytes = bytes;
+    }
+    uint32_t us = ((uint32_t)maxBytes * 8000000UL + _clockSpeed - 1) / _clockSpeed;
+    if (us < _measuredTransferUs) us = _measuredTransferUs;
+    _displayTransferUs = (uint16_t)us;
+    updateOnTime();
+}
+
+// 틱 주기에서 BLANK 구간(전송 + lead/trail 가드)을 뺀 나머지를 감마 보정 밝기에 비례하게 표시
+// 전송 구간 = 디스플레이 1개 전송 시간 x 틱당 디스플레이 수 + 여유 (최소 DEFAULT_BLANK_GUARD_US)
+void MAX6921_DisplayManager::updateOnTime() {
+    uint32_t reserve = (uint32_t)_displayTransferUs * displaysPerTick() + MAX6921_TRANSFER_MARGIN_US;
+    if (reserve < DEFAULT_BLANK_GUARD_US) reserve = DEFAULT_BLANK_GUARD_US;
+    uint32_t guard = reserve + _blankLeadUs + _blankTrailUs;
+    uint16_t usable = (_gridPeriodUs > guard) ? (uint16_t)(_gridPeriodUs - guard) : 0;
+    _onTimeUs = (uint16_t)(((uint32_t)usable * max6921BrightnessToDuty(_brightness, _maxBrightness)) >> 16);
+}
+
+uint32_t MAX6921_DisplayManager::getScanCount(uint8_t index) {
+    if (index >= _count) return 0;
+    return _displays[index].scanCount;
+}
+
+uint32_t MAX6921_DisplayManager::getTickCount() {
+    return _tickCount;
+}
+
+void MAX6921_DisplayManager::resetStats() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _displays[i].scanCount = 0;
+    }
+    _tickCount = 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * MAX6921_DisplayManager.h
+ *
+ * 여러 VFD를 하나의 SPI 버스 + 하나의 스캔 틱으로 구동하는 관리자
+ *
+ * ===== 하드웨어 연결 =====
+ *
+ *   DIN, CLK, BLANK : 모든 디스플레이의 MAX6921 체인에 공통
+ *   LOAD            : 디스플레이마다 별도 핀
+ *
+ * DIN/CLK가 공통이므로 한 디스플레이로 보내는 비트는 모든 체인의 시프트 레지스터에
+ * 들어간다. MAX6921은 LOAD HIGH 동안 래치가 투명하므로 관리자는 LOAD를 평상시 LOW로
+ * 두고, 해당 디스플레이의 프레임을 다 보낸 뒤에만 LOAD를 HIGH → LOW로 펄스한다.
+ * (각 디스플레이의 MAX6921_VFD_Driver::begin()/refresh()는 호출하지 않음)
+ *
+ * 드라이버 refresh()가 하던 화면 단위 갱신 중 효과(marquee/wipe/crossfade 문자 교체)는
+ * 관리자 refresh()가 틱마다 표시 구간에서 updateEffects()로 진행한다 (타이머 틱이면 loop()에서 직접 호출).
+ * BLANK가 공통이므로 디스플레이별 밝기, fadeTo(), 깜박임/크로스페이드 레벨은 적용되지 않고
+ * 밝기는 관리자 setBrightness()로만 바뀐다.
+ *
+ * ===== 스캔 틱 =====
+ *
+ *   BLANK ON → (lead) → SPI 트랜잭션 1회 안에서 디스플레이별 [프레임 전송 + LOAD 펄스] → (trail) → BLANK OFF
+ *
+ * lead/trail(setBlankGuard)은 드라이버와 같은 고스팅 방지 가드이며 refresh()에서 블로킹 없이 기다린다.
+ * BLANK 예약(전송 구간)은 디스플레이 1개 전송 시간 x 틱당 디스플레이 수 + 여유이며,
+ * 전송 시간은 SPI 클록과 프레임 크기로 추정해 두고 scanTick()에서 측정한 값이 더 크면 그 값을 쓴다.
+ * 표시 구간은 마지막 LOAD 시각부터 재므로 디스플레이가 늘어도 표시 시간이 줄지 않는다.
+ * 스캔 순서는 디스플레이별 드라이버 설정(setScanOrder)을 따른다.
+ *
+ * BLANK 전환, 트랜잭션 시작/종료, 시간 확인은 디스플레이 수와 관계없이 틱마다 1회이므로
+ * 디스플레이가 늘어도 추가 비용은 프레임 바이트와 LOAD 펄스뿐이다.
+ *
+ * 틱당 스캔할 디스플레이 수를 제한하면(setMaxDisplaysPerTick) 시작 위치를 돌려가며
+ * 스캔하므로 모든 디스플레이가 같은 비율로 스캔된다 (라운드 로빈).
+ * 스캔되지 않은 디스플레이는 다음 차례까지 직전 그리드를 유지하므로 그리드별 점등 시간은 같다.
+ *
+ * 밝기는 BLANK가 공통이므로 관리자 단위로 설정한다.
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_DISPLAY_MANAGER_H
+#define MAX6921_DISPLAY_MANAGER_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "MAX6921_VFD_Driver.h"
+
+#define MAX6921_MANAGER_MAX_DISPLAYS  8
+
+class MAX6921_DisplayManager {
+private:
+    struct Entry {
+        MAX6921_VFD_Driver* display;
+        uint8_t loadPin;
+        uint32_t scanCount;               // 누적 그리드 스캔 수
+    };
+
+    Entry _displays[MAX6921_MANAGER_MAX_DISPLAYS];
+    uint8_t _count;
+    uint8_t _nextDisplay;                 // 라운드 로빈 시작 위치
+    uint8_t _maxPerTick;                  // 0 = 매 틱 전체
+
+    uint8_t _blankPin;                    // Common BLANK pin for all displays
+    SPISettings _settings;
+    uint32_t _clockSpeed;
+    bool _blanked;
+
+    uint8_t _brightness;
+    uint8_t _maxBrightness;
+    uint16_t _gridPeriodUs;
+    uint16_t _onTimeUs;                   // 틱마다 BLANK 해제 시간
+    uint16_t _blankLeadUs;                // BLANK → LOAD 최소 간격
+    uint16_t _blankTrailUs;               // LOAD → BLANK 해제 최소 간격
+    uint16_t _displayTransferUs;          // 디스플레이 1개 전송 + LOAD 시간 (추정, 측정값이 크면 갱신)
+    volatile uint16_t _measuredTransferUs;  // scanTick()에서 측정한 디스플레이당 최대 전송 시간
+    uint8_t _phase;                       // 0 = 표시, 1 = lead 대기, 2 = trail 대기
+    unsigned long _latchTime;
+    unsigned long _lastTick;
+    uint32_t _tickCount;
+
+    uint8_t displaysPerTick();
+    void estimateTransferTime();          // SPI 클록 x 가장 큰 프레임
+    void updateOnTime();
+
+public:
+    MAX6921_DisplayManager(uint8_t blankPin, uint8_t maxBrightness = 255);
+
+    // begin() 전에 등록 (최대 MAX6921_MANAGER_MAX_DISPLAYS개)
+    bool addDisplay(MAX6921_VFD_Driver* display);
+    uint8_t getDisplayCount();
+
+    void begin(uint32_t spiClockSpeed = DEFAULT_SPI_CLOCK_SPEED);
+
+    // 폴링 스캔 (loop()에서 자주 호출)
+    void refresh();
+
+    // 틱 1회 (타이머 ISR에서 직접 호출 가능, 시간 확인 없음)
+    // 타이머에서 호출할 때는 BLANK도 호출한 쪽이 setBlank()로 처리
+    void scanTick();
+    void setBlank(bool blank);            // 공통 BLANK 핀 (true = 모든 디스플레이 출력 끔)
+
+    // 등록된 디스플레이의 효과 진행 (refresh()가 틱마다 호출, 타이머 틱이면 loop()에서 호출)
+    void updateEffects();
+
+    void setMaxDisplaysPerTick(uint8_t count);
+    void setGridPeriod(uint16_t periodUs);
+    void setBlankGuard(uint16_t leadUs, uint16_t trailUs = DEFAULT_BLANK_TRAIL_US);  // 폴링 refresh()에서만 적용
+    uint16_t getGridPeriod();
+    void setBrightness(uint8_t brightness);
+    uint8_t getBrightness();
+    uint16_t getOnTimeUs();
+    uint16_t getTransferTimeUs();         // 디스플레이 1개 전송 시간 (BLANK 예약 = x 틱당 디스플레이 수 + 여유)
+
+    // 통계 (디스플레이별 초당 그리드 스캔 수 = getScanCount() 차이 / 경과 시간)
+    uint32_t getScanCount(uint8_t index);
+    uint32_t getTickCount();
+    void resetStats();
+};
+
+#endif // MAX6921_DISPLAY_MANAGER_H
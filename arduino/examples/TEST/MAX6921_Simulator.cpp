@@ -0,0 +1,375 @@
+/*
+ * MAX6921_Simulator.cpp
+ *
+ * Implementation file for virtual MAX6921 chain and VFD glass
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_Simulator.h"
+
+// ===========================================
+// MAX6921_SimChain
+// ===========================================
+
+MAX6921_SimChain::MAX6921_SimChain(uint8_t numChips) {
+    if (numChips == 0) numChips = 1;
+    if (numChips > MAX6921_SIM_MAX_CHIPS) numChips = MAX6921_SIM_MAX_CHIPS;
+    _numChips = numChips;
+    reset();
+}
+
+void MAX6921_SimChain::reset() {
+    memset(_shift, 0, sizeof(_shift));
+    memset(_latch, 0, sizeof(_latch));
+    _load = false;
+    _blank = false;
+    _clockCount = 0;
+    _latchCount = 0;
+    _transparentClocks = 0;
+    _loadLowClocks = 0xFFFF;          // 초기 LOAD HIGH는 전송 없는 래치이므로 검사 제외
+    _shortLatches = 0;
+}
+
+// CLK 상승 에지: 모든 비트가 체인 뒤쪽으로 한 칸 이동
+void MAX6921_SimChain::clock(bool din) {
+    uint8_t numBits = getNumBits();
+
+    for (int8_t w = MAX6921_SIM_WORDS - 1; w > 0; w--) {
+        _shift[w] = (_shift[w] << 1) | (_shift[w - 1] >> 31);
+    }
+    _shift[0] = (_shift[0] << 1) | (din ? 1 : 0);
+
+    // 체인 길이를 넘은 비트는 DOUT으로 밀려나감
+    for (uint8_t w = 0; w < MAX6921_SIM_WORDS; w++) {
+        uint8_t base = w * 32;
+        if (base >= numBits) {
+            _shift[w] = 0;
+        } else if (numBits - base < 32) {
+            _shift[w] &= (1UL << (numBits - base)) - 1;
+        }
+    }
+
+    _clockCount++;
+    if (!_load && _loadLowClocks < 0xFFFF) _loadLowClocks++;
+
+    // LOAD HIGH 동안은 래치가 투명하므로 시프트 중인 값이 그대로 출력됨
+    if (_load) {
+        memcpy(_latch, _shift, sizeof(_latch));
+        _transparentClocks++;
+    }
+}
+
+void MAX6921_SimChain::setLoad(bool level) {
+    if (level) {
+        if (!_load) {
+            _latchCount++;
+            // 체인 전체가 새 데이터로 채워지기 전에 래치하면 이전 프레임 비트가 섞임
+            if (_loadLowClocks < getNumBits()) _shortLatches++;
+        }
+        memcpy(_latch, _shift, sizeof(_latch));
+    } else if (_load) {
+        _loadLowClocks = 0;
+    }
+    _load = level;
+}
+
+void MAX6921_SimChain::setBlank(bool level) {
+    _blank = level;
+}
+
+bool MAX6921_SimChain::getOutput(uint8_t bit) const {
+    return !_blank && getLatch(bit);
+}
+
+bool MAX6921_SimChain::getLatch(uint8_t bit) const {
+    if (bit >= getNumBits()) return false;
+    return (_latch[bit >> 5] >> (bit & 31)) & 1;
+}
+
+bool MAX6921_SimChain::isBlanked() const {
+    return _blank;
+}
+
+uint8_t MAX6921_SimChain::getNumChips() const {
+    return _numChips;
+}
+
+uint8_t MAX6921_SimChain::getNumBits() const {
+    return _numChips * MAX6921_OUTPUT_BITS;
+}
+
+uint32_t MAX6921_SimChain::getClockCount() const {
+    return _clockCount;
+}
+
+uint32_t MAX6921_SimChain::getLatchCount() const {
+    return _latchCount;
+}
+
+uint32_t MAX6921_SimChain::getTransparentClockCount() const {
+    return _transparentClocks;
+}
+
+uint32_t MAX6921_SimChain::getShortLatchCount() const {
+    return _shortLatches;
+}
+
+// ===========================================
+// VFD_SimGlass
+// ===========================================
+
+VFD_SimGlass::VFD_SimGlass(const uint8_t* gridChainBits, uint8_t numGrids,
+                           const uint8_t* segmentChainBits, uint8_t numSegments)
+    : _gridChainBits(gridChainBits), _segmentChainBits(segmentChainBits) {
+    if (numGrids > VFD_SIM_MAX_GRIDS) numGrids = VFD_SIM_MAX_GRIDS;
+    if (numSegments > VFD_SIM_MAX_SEGMENTS) numSegments = VFD_SIM_MAX_SEGMENTS;
+    _numGrids = numGrids;
+    _numSegments = numSegments;
+    _outputDecayUs = 0;
+    reset();
+}
+
+void VFD_SimGlass::reset() {
+    memset(_segmentOnTime, 0, sizeof(_segmentOnTime));
+    memset(_ghostTime, 0, sizeof(_ghostTime));
+    memset(_gridOnTime, 0, sizeof(_gridOnTime));
+    memset(_gridDriven, 0, sizeof(_gridDriven));
+    memset(_segmentDriven, 0, sizeof(_segmentDriven));
+    memset(_gridTail, 0, sizeof(_gridTail));
+    memset(_segmentTail, 0, sizeof(_segmentTail));
+    memset(_gridPattern, 0, sizeof(_gridPattern));
+    _overlapTime = 0;
+    _elapsedTime = 0;
+}
+
+void VFD_SimGlass::setOutputDecay(uint16_t us) {
+    _outputDecayUs = us;
+}
+
+uint16_t VFD_SimGlass::getOutputDecay() const {
+    return _outputDecayUs;
+}
+
+// 전극 구동 상태를 갱신하고 (꺼진 전극은 잔류 시작), 잔류가 끝나는 시점마다 나누어 누적
+void VFD_SimGlass::accumulate(const MAX6921_SimChain& chain, uint32_t us) {
+    uint32_t segments = 0;
+    for (uint8_t seg = 0; seg < _numSegments; seg++) {
+        bool driven = chain.getOutput(pgm_read_byte(&_segmentChainBits[seg]));
+        if (_segmentDriven[seg] && !driven) _segmentTail[seg] = _outputDecayUs;
+        if (driven) {
+            _segmentTail[seg] = 0;
+            segments |= 1UL << seg;
+        }
+        _segmentDriven[seg] = driven;
+    }
+    for (uint8_t grid = 0; grid < _numGrids; grid++) {
+        bool driven = chain.getOutput(pgm_read_byte(&_gridChainBits[grid]));
+        if (_gridDriven[grid] && !driven) _gridTail[grid] = _outputDecayUs;
+        if (driven) {
+            _gridTail[grid] = 0;
+            _gridPattern[grid] = segments;
+        }
+        _gridDriven[grid] = driven;
+    }
+
+    while (us > 0) {
+        uint32_t span = us;
+        for (uint8_t grid = 0; grid < _numGrids; grid++) {
+            if (_gridTail[grid] > 0 && _gridTail[grid] < span) span = _gridTail[grid];
+        }
+        for (uint8_t seg = 0; seg < _numSegments; seg++) {
+            if (_segmentTail[seg] > 0 && _segmentTail[seg] < span) span = _segmentTail[seg];
+        }
+
+        accumulateSpan(span);
+
+        for (uint8_t grid = 0; grid < _numGrids; grid++) {
+            _gridTail[grid] = (_gridTail[grid] > span) ? (uint16_t)(_gridTail[grid] - span) : 0;
+        }
+        for (uint8_t seg = 0; seg < _numSegments; seg++) {
+            _segmentTail[seg] = (_segmentTail[seg] > span) ? (uint16_t)(_segmentTail[seg] - span) : 0;
+        }
+        us -= span;
+    }
+}
+
+// 전극 상태가 변하지 않는 구간 누적: 둘 다 구동 중이면 점등,
+// 하나라도 잔류 중이면 그리드의 마지막 패턴에 없던 셀만 고스트 (있던 셀은 잔광)
+void VFD_SimGlass::accumulateSpan(uint32_t us) {
+    uint8_t activeGrids = 0;
+
+    _elapsedTime += us;
+
+    for (uint8_t grid = 0; grid < _numGrids; grid++) {
+        bool gridDriven = _gridDriven[grid];
+        if (!gridDriven && _gridTail[grid] == 0) continue;
+
+        if (gridDriven) {
+            activeGrids++;
+            _gridOnTime[grid] += us;
+        }
+
+        for (uint8_t seg = 0; seg < _numSegments; seg++) {
+            bool segDriven = _segmentDriven[seg];
+            if (!segDriven && _segmentTail[seg] == 0) continue;
+
+            if (gridDriven && segDriven) {
+                _segmentOnTime[grid][seg] += us;
+            } else if (!((_gridPattern[grid] >> seg) & 1)) {
+                _ghostTime[grid][seg] += us;
+            }
+        }
+    }
+
+    if (activeGrids > 1) _overlapTime += us;
+}
+
+uint32_t VFD_SimGlass::getSegmentOnTime(uint8_t grid, uint8_t segment) const {
+    if (grid >= _numGrids || segment >= _numSegments) return 0;
+    return _segmentOnTime[grid][segment];
+}
+
+uint32_t VFD_SimGlass::getGhostTime(uint8_t grid, uint8_t segment) const {
+    if (grid >= _numGrids || segment >= _numSegments) return 0;
+    return _ghostTime[grid][segment];
+}
+
+uint32_t VFD_SimGlass::getTotalGhostTime() const {
+    uint32_t total = 0;
+    for (uint8_t grid = 0; grid < _numGrids; grid++) {
+        for (uint8_t seg = 0; seg < _numSegments; seg++) {
+            total += _ghostTime[grid][seg];
+        }
+    }
+    return total;
+}
+
+uint32_t VFD_SimGlass::getGridOnTime(uint8_t grid) const {
+    if (grid >= _numGrids) return 0;
+    return _gridOnTime[grid];
+}
+
+uint32_t VFD_SimGlass::getOverlapTime() const {
+    return _overlapTime;
+}
+
+uint32_t VFD_SimGlass::getElapsedTime() const {
+    return _elapsedTime;
+}
+
+uint16_t VFD_SimGlass::getSegmentDuty(uint8_t grid, uint8_t segment) const {
+    if (_elapsedTime == 0) return 0;
+    return (uint16_t)(((uint64_t)getSegmentOnTime(grid, segment) * 65535UL) / _elapsedTime);
+}
+
+uint8_t VFD_SimGlass::getNumGrids() const {
+    return _numGrids;
+}
+
+uint8_t VFD_SimGlass::getNumSegments() const {
+    return _numSegments;
+}
+
+// ===========================================
+// MAX6921_SimTransport
+// ===========================================
+
+MAX6921_SimTransport::MAX6921_SimTransport(uint8_t numChips, VFD_SimGlass* glass)
+    : _chain(numChips), _glass(glass), _timeUs(0), _frameCount(0),
+      _clockHz(0), _pendingBits(0), _shiftedBits(0), _clockRemainder(0),
+      _blankReleasesDuringShift(0) {
+}
+
+void MAX6921_SimTransport::begin() {
+    _chain.reset();
+    _chain.setLoad(true);             // SPI 전송과 같이 LOAD 대기 상태는 HIGH
+    _timeUs = 0;
+    _frameCount = 0;
+    _pendingBits = 0;
+    _shiftedBits = 0;
+    _clockRemainder = 0;
+    _blankReleasesDuringShift = 0;
+}
+
+// SPI 전송과 같은 순서: LOAD LOW → 바이트별 MSB First 시프트 → LOAD HIGH
+// 비동기 모드에서는 LOAD LOW까지만 하고 나머지는 advance()에서 진행
+void MAX6921_SimTransport::send(const uint8_t* frame, uint8_t length) {
+    if (length == 0) return;
+    if (length > MAX6921_ASYNC_MAX_BYTES) length = MAX6921_ASYNC_MAX_BYTES;
+
+    // 이전 프레임이 남아 있으면 실제 전송 계층처럼 끝날 때까지 진행 (대기 시간은 무시)
+    if (isBusy()) shiftPending(_pendingBits - _shiftedBits);
+
+    memcpy(_pending, frame, length);
+    _pendingBits = length * 8;
+    _shiftedBits = 0;
+    _chain.setLoad(false);
+
+    if (_clockHz == 0) shiftPending(_pendingBits);
+}
+
+// 대기 중인 비트를 bits개 클록, 마지막 비트 뒤에 LOAD HIGH + 완료 통지
+void MAX6921_SimTransport::shiftPending(uint8_t bits) {
+    while (bits > 0 && _shiftedBits < _pendingBits) {
+        uint8_t byte = _pending[_shiftedBits >> 3];
+        _chain.clock((byte >> (7 - (_shiftedBits & 7))) & 1);
+        _shiftedBits++;
+        bits--;
+    }
+
+    if (_pendingBits > 0 && _shiftedBits >= _pendingBits) {
+        _pendingBits = 0;
+        _shiftedBits = 0;
+        _chain.setLoad(true);
+        _frameCount++;
+        notifyTransferComplete();
+    }
+}
+
+bool MAX6921_SimTransport::isBusy() {
+    return _shiftedBits < _pendingBits;
+}
+
+void MAX6921_SimTransport::blank(bool blanked) {
+    if (!blanked && isBusy()) _blankReleasesDuringShift++;
+    _chain.setBlank(blanked);
+}
+
+void MAX6921_SimTransport::setClockSpeed(uint32_t clockHz) {
+    _clockHz = clockHz;
+    _clockRemainder = 0;
+}
+
+uint32_t MAX6921_SimTransport::getBlankReleaseDuringShiftCount() const {
+    return _blankReleasesDuringShift;
+}
+
+// 현재 출력 상태로 점등 시간을 누적한 뒤, 그 시간 동안 클록될 비트를 진행
+void MAX6921_SimTransport::advance(uint32_t us) {
+    if (_glass) _glass->accumulate(_chain, us);
+    _timeUs += us;
+
+    if (isBusy()) {
+        uint64_t clocks = (uint64_t)us * _clockHz + _clockRemainder;
+        uint32_t bits = (uint32_t)(clocks / 1000000UL);
+        _clockRemainder = (uint32_t)(clocks % 1000000UL);
+        shiftPending(bits > 255 ? 255 : (uint8_t)bits);
+    } else {
+        _clockRemainder = 0;
+    }
+}
+
+uint32_t MAX6921_SimTransport::getTimeUs() const {
+    return _timeUs;
+}
+
+uint32_t MAX6921_SimTransport::getFrameCount() const {
+    return _frameCount;
+}
+
+MAX6921_SimChain& MAX6921_SimTransport::getChain() {
+    return _chain;
+}
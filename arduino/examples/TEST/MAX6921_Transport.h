@@ -0,0 +1,140 @@
+/*
+ * MAX6921_Transport.h
+ * 
+ * MAX6921 데이지 체인 전송 계층
+ * 
+ * ===== 체인 프레임 형식 =====
+ * 
+ * - 칩 N개 = N x 20비트 시프트 레지스터 (칩 #1이 MCU에 가장 가까움)
+ * - 마지막 칩(#N) 데이터가 먼저 나가야 하므로 체인 전체를 하나의 큰 정수로 보고
+ *   MSB First(빅 엔디언)로 전송: 체인 비트 k = 칩 #(k/20 + 1)의 OUT(k%20)
+ * - 20비트 워드를 바이트 경계 없이 연속으로 채움 (2칩 = 40비트 = 5바이트)
+ * - 바이트 정렬용 패딩 비트는 프레임 맨 앞에 위치하여 체인 밖으로 밀려나감
+ * 
+ * 전송 계층은 LOAD 핀과 바이트 전송만 담당하며, BLANK 및 스캔 타이밍은
+ * MAX6921_VFD_Driver가 담당한다. (BLANK 변경은 blank()로 통지만 받음)
+ * 
+ * ===== 비동기 전송 =====
+ * 
+ * send()는 전송이 끝나기 전에 반환될 수 있다 (isBusy() == true).
+ * 이 경우 LOAD는 마지막 비트가 클록된 뒤 전송 계층이 올리고, 그 직후
+ * 완료 콜백을 호출한다 (인터럽트 문맥일 수 있음). 동기 전송도 LOAD를 올린 뒤
+ * 같은 콜백을 호출하므로 드라이버는 두 경우를 구분하지 않는다.
+ * 전송 중에 send()를 다시 호출하면 이전 프레임이 끝날 때까지 기다린다.
+ * 
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef MAX6921_TRANSPORT_H
+#define MAX6921_TRANSPORT_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// MAX6921 하드웨어 사양
+#define MAX6921_OUTPUT_BITS 20    // MAX6921 한 개당 출력 비트 수
+#define MAX6921_MAX_SPI_CLOCK 5000000  // 데이터시트 tCP 최소 200ns → 최대 5MHz
+
+// 칩 N개 체인 프레임 바이트 수 (20비트 워드를 빈틈없이 채움)
+#define MAX6921_CHAIN_BYTES(chips) (((chips) * MAX6921_OUTPUT_BITS + 7) / 8)
+
+// 칩별 20비트 워드 → 체인 프레임 (chipWords[0] = 칩 #1)
+// out에는 MAX6921_CHAIN_BYTES(numChips) 바이트가 기록됨
+void max6921PackChain(const uint32_t* chipWords, uint8_t numChips, uint8_t* out);
+
+// 체인 비트 k (0 = 칩 #1 OUT0) 설정
+inline void max6921SetChainBit(uint8_t* frame, uint8_t frameBytes, uint8_t bit) {
+    frame[frameBytes - 1 - (bit >> 3)] |= (uint8_t)(1 << (bit & 7));
+}
+
+// 전송 완료 콜백 (LOAD 상승 직후 호출, ISR 문맥일 수 있음)
+typedef void (*MAX6921_TransferCallback)(void* context);
+
+// 전송 계층 인터페이스
+// send()는 LOAD를 내리고 프레임을 한 번에 전송한 뒤 LOAD를 올려 모든 칩 출력을 동시에 갱신
+class MAX6921_Transport {
+private:
+    MAX6921_TransferCallback _onComplete;
+    void* _onCompleteContext;
+    
+protected:
+    // LOAD를 올린 직후 구현 클래스가 호출
+    void notifyTransferComplete() {
+        if (_onComplete != NULL) _onComplete(_onCompleteContext);
+    }
+    
+public:
+    MAX6921_Transport() : _onComplete(NULL), _onCompleteContext(NULL) {}
+    virtual ~MAX6921_Transport() {}
+    
+    virtual void begin() = 0;
+    virtual void send(const uint8_t* frame, uint8_t length) = 0;
+    
+    // 전송 진행 중 여부 (동기 전송은 항상 false)
+    virtual bool isBusy() { return false; }
+    
+    // BLANK 핀 변경 통지 (드라이버가 BLANK 핀을 직접 구동하므로 기본은 무시)
+    // 하드웨어 PWM BLANK 경로에서는 호출되지 않음
+    virtual void blank(bool blanked) { (void)blanked; }
+    
+    void setTransferCallback(MAX6921_TransferCallback callback, void* context) {
+        _onComplete = callback;
+        _onCompleteContext = context;
+    }
+};
+
+// 하드웨어 SPI 전송 (기본)
+class MAX6921_SPITransport : public MAX6921_Transport {
+protected:
+    uint8_t _loadPin;          // Common LOAD pin for all MAX6921 chips
+    SPISettings _settings;
+    
+public:
+    MAX6921_SPITransport(uint8_t loadPin, uint32_t clockSpeed = 4000000);
+    
+    void setClockSpeed(uint32_t clockSpeed);
+    
+    virtual void begin();
+    virtual void send(const uint8_t* frame, uint8_t length);
+};
+
+// 인터럽트 연쇄 SPI 전송 지원 여부 (AVR SPI 전송 완료 인터럽트 사용)
+// SPI_STC_vect는 AVR io 헤더(또는 tests/host shim의 SPI 레지스터 모델)가 정의
+#if defined(SPI_STC_vect)
+#define MAX6921_HAS_ASYNC_SPI 1
+#else
+#define MAX6921_HAS_ASYNC_SPI 0
+#endif
+
+// 최대 비동기 프레임 크기 (4칩 = 10바이트)
+#define MAX6921_ASYNC_MAX_BYTES MAX6921_CHAIN_BYTES(4)
+
+// 비동기 SPI 전송
+// 첫 바이트만 쓰고 반환하며, 나머지 바이트는 SPI 전송 완료 인터럽트에서 이어서 전송.
+// 마지막 바이트의 전송 완료(SPIF) = 마지막 비트가 클록된 뒤이므로 그 때 LOAD를 올림.
+// 그리드 1개 전송 동안 CPU가 대기하지 않음 (5바이트 @ 4MHz: 약 10us → ISR 진입 5회)
+// SPI 인터럽트는 하나뿐이므로 한 인스턴스만 동시에 전송 가능.
+// 지원하지 않는 보드에서는 MAX6921_SPITransport와 같이 동기 전송 후 콜백 호출
+// (DMA가 있는 보드는 send()/transferISR()만 해당 보드의 DMA 완료 인터럽트로 바꾸면 됨)
+class MAX6921_AsyncSPITransport : public MAX6921_SPITransport {
+private:
+    uint8_t _buffer[MAX6921_ASYNC_MAX_BYTES];  // 전송 중인 프레임 복사본
+    volatile uint8_t _length;
+    volatile uint8_t _index;                   // 다음에 쓸 바이트
+    volatile bool _busy;
+    
+    void waitIdle();
+    
+public:
+    MAX6921_AsyncSPITransport(uint8_t loadPin, uint32_t clockSpeed = 4000000);
+    
+    virtual void begin();
+    virtual void send(const uint8_t* frame, uint8_t length);
+    virtual bool isBusy();
+    
+    void transferISR();                        // SPI ISR 전용 (직접 호출하지 말 것)
+};
+
+#endif // MAX6921_TRANSPORT_H
@@ -10,22 +10,241 @@
 
 #include "MAX6921_VFD_Driver.h"
 
+// 숫자 표시용 10의 거듭제곱 (uint32_t 범위 전체)
+static const uint32_t MAX6921_POW10[10] PROGMEM = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+#define MAX6921_NUMBER_OVERFLOW   ((int32_t)0x80000000UL)  // drawNumber(): 모든 자리 '-'
+
+// ISR 안에서도 안전하게 쓸 수 있는 인터럽트 보호 구간
+// 들어갈 때의 인터럽트 상태를 저장했다가 복원하므로 중첩해도, ISR(updateFade → updateBlankTiming 등)이나
+// 사용자의 noInterrupts() 구간 안에서 호출해도 인터럽트를 다시 켜지 않음
+// 다른 코어는 빌드 플래그나 이 파일 앞에서 MAX6921_ATOMIC_BEGIN()/END()를 직접 정의할 수 있음
+#ifndef MAX6921_ATOMIC_BEGIN
+#if defined(__AVR__)
+#include <avr/interrupt.h>
+#endif
+#if defined(SREG)
+// AVR (tests/host shim도 SREG 모델 제공): 상태 레지스터 I 비트
+#define MAX6921_ATOMIC_BEGIN()  uint8_t _savedSREG = SREG; cli()
+#define MAX6921_ATOMIC_END()    SREG = _savedSREG
+#elif defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+      defined(__ARM_ARCH_8M_BASE__) || defined(__ARM_ARCH_8M_MAIN__)
+// Cortex-M: PRIMASK
+static inline uint32_t max6921AtomicBegin() {
+    uint32_t primask;
+    __asm__ volatile ("mrs %0, primask" : "=r" (primask));
+    __asm__ volatile ("cpsid i" ::: "memory");
+    return primask;
+}
+static inline void max6921AtomicEnd(uint32_t primask) {
+    __asm__ volatile ("msr primask, %0" :: "r" (primask) : "memory");
+}
+#define MAX6921_ATOMIC_BEGIN()  uint32_t _savedPrimask = max6921AtomicBegin()
+#define MAX6921_ATOMIC_END()    max6921AtomicEnd(_savedPrimask)
+#else
+// 상태를 읽을 수 없는 코어: 중첩 깊이로 가장 바깥 구간이 끝날 때만 interrupts()
+// 스캔 ISR은 진입 시 깊이를 올려 ISR 안의 구간이 인터럽트를 켜지 않게 함
+// (사용자 ISR/noInterrupts() 구간 안에서 드라이버를 부르려면 MAX6921_ATOMIC_BEGIN/END를 직접 정의)
+static volatile uint8_t max6921AtomicDepth = 0;
+static inline void max6921AtomicBegin() {
+    noInterrupts();
+    max6921AtomicDepth++;
+}
+static inline void max6921AtomicEnd() {
+    if (--max6921AtomicDepth == 0) interrupts();
+}
+#define MAX6921_ATOMIC_BEGIN()  max6921AtomicBegin()
+#define MAX6921_ATOMIC_END()    max6921AtomicEnd()
+#define MAX6921_ISR_ENTER()     max6921AtomicDepth++
+#define MAX6921_ISR_EXIT()      max6921AtomicDepth--
+#endif
+#endif
+
+#ifndef MAX6921_ISR_ENTER
+#define MAX6921_ISR_ENTER()
+#define MAX6921_ISR_EXIT()
+#endif
+
+// 단계별 시간 측정 (MAX6921_PROFILE이 없으면 코드 생성 없음)
+#ifdef MAX6921_PROFILE
+#define MAX6921_PROFILE_START(t)        uint32_t t = MAX6921_PROFILE_CLOCK()
+#define MAX6921_PROFILE_STOP(stage, t)  profileRecord(stage, MAX6921_PROFILE_CLOCK() - (t))
+#else
+#define MAX6921_PROFILE_START(t)
+#define MAX6921_PROFILE_STOP(stage, t)
+#endif
+
+#if MAX6921_HAS_SCAN_TIMER
+// 타이머 ISR이 스캔할 드라이버 인스턴스 (Timer1은 하나뿐이므로 한 개만 등록)
+static MAX6921_VFD_Driver* _scanTimerInstance = NULL;
+
+// Timer1 프리스케일러 8 기준 1us당 카운트 수 (16MHz: 2, 8MHz: 1)
+#define MAX6921_TIMER1_TICKS_PER_US  (F_CPU / 8UL / 1000000UL)
+
+// Timer1 Fast PWM (TOP = ICR1) 한 주기 = 그리드 슬롯 1개
+//   TOP 도달 (OVF)     : BLANK ON → 다음 그리드 프레임 전송 + LOAD
+//   OCR1A/OCR1B 일치   : BLANK OFF → 남은 시간 동안 표시
+// BLANK 핀이 OC1A/OC1B이면 하드웨어가 핀을 직접 제어하고, 아니면 COMPB ISR에서 제어
+ISR(TIMER1_OVF_vect) {
+    MAX6921_ISR_ENTER();
+    if (_scanTimerInstance != NULL) {
+        _scanTimerInstance->scanISR();
+    }
+    MAX6921_ISR_EXIT();
+}
+
+ISR(TIMER1_COMPB_vect) {
+    MAX6921_ISR_ENTER();
+    if (_scanTimerInstance != NULL) {
+        _scanTimerInstance->blankReleaseISR();
+    }
+    MAX6921_ISR_EXIT();
+}
+#endif
+
+// 밝기 → 표시 비율 (16비트 고정소수점, 감마 2.0 근사)
+// 사람 눈은 밝기를 로그에 가깝게 느끼므로 선형 듀티로는 낮은 밝기 구간이 거칠게 변함
+uint16_t max6921BrightnessToDuty(uint8_t brightness, uint8_t maxBrightness) {
+    if (maxBrightness == 0 || brightness >= maxBrightness) return 0xFFFF;
+    uint32_t b = brightness;
+    uint32_t m = maxBrightness;
+    return (uint16_t)((b * b * 0xFFFFUL) / (m * m));
+}
+
 // Constructor
 MAX6921_VFD_Driver::MAX6921_VFD_Driver(uint8_t loadPin, uint8_t blankPin, 
-                                       uint8_t numGrids, uint8_t numSegments, uint8_t maxBrightness) {
+                                       uint8_t numGrids, uint8_t numSegments, uint8_t maxBrightness)
+    : _spiTransport(loadPin, DEFAULT_SPI_CLOCK_SPEED), _effects(this) {
     _loadPin = loadPin;
     _blankPin = blankPin;
-    _numGrids = numGrids;
-    _numSegments = numSegments;
+    _transport = &_spiTransport;
+    _transport->setTransferCallback(transferCompleteCallback, this);
+    (void)numGrids;                       // 형상은 튜브 프로필에서 가져옴
+    (void)numSegments;
     _maxBrightness = maxBrightness;
     
     _currentGrid = 0;
     _brightness = maxBrightness;
+    _nominalBrightness = maxBrightness;
     _gridScanDelay = DEFAULT_GRID_SCAN_DELAY_US;
     _lastGridScan = 0;
+    _timerScan = false;
+    _maxScanTimeUs = 0;
+    _blanked = false;
+    _releaseOnLatch = false;
+    _blankHardwarePwm = false;
+    _blankLeadUs = DEFAULT_BLANK_LEAD_US;
+    _blankTrailUs = DEFAULT_BLANK_TRAIL_US;
+    _scanPhase = SCAN_SHOW;
+    _latchTime = 0;
+    _scanSlot = 0;
+    _scanOrderMode = MAX6921_SCAN_SEQUENTIAL;
+    _targetFrameRate = 0;
+    _scanReserveUs = DEFAULT_BLANK_GUARD_US;
+    _frameRateLimited = false;
+    _transferStart = 0;
+    _frameTransferUs = 0;
+    _transferTimeUs = 0;
+    _frameStart = 0;
+    _framePeriodUs = 0;
+    _frameCount = 0;
+    _missedDeadlines = 0;
+    _frameDone = false;
+    _timerTop = 0;
+    _pendingTimerTop = 0;
+    _armedTimerTop = 0;
+    _fading = false;
+    _fadeFrom = 0;
+    _fadeTo = 0;
+    _fadeStartMs = 0;
+    _fadeDurationMs = 0;
+    _fallbackGlyph = 0;
     
-    // Clear display data
-    clear();
+    for (uint8_t i = 0; i < VFD_MAX_GRIDS; i++) {
+        _gridDwellTrim[i] = 255;
+        _gridEffectLevel[i] = 255;
+    }
+    
+    _front = &_frameBuffers[0];
+    _ready = &_frameBuffers[1];
+    _back = &_frameBuffers[2];
+    _flipPending = false;
+    _autoPresent = true;
+    _lastRebuildCount = 0;
+    _totalRebuildCount = 0;
+    _fontLookupCount = 0;
+#ifdef MAX6921_PROFILE
+    memset(_profile, 0, sizeof(_profile));
+    _profileFrameTime = 0;
+#endif
+    
+    // 기본 튜브 프로필로 시작 (세 버퍼 모두 빈 화면)
+    MAX6921_TubeProfile tube;
+    max6921LoadTubeProfile(VFD_DEFAULT_PROFILE, &tube);
+    applyTubeProfile(tube);
+}
+
+// 튜브 프로필 적용: 형상 값을 바꾸고 빈 화면을 새 체인 배치로 세 버퍼 모두에 인코딩
+// 이후 스캔 핫패스는 프레임 바이트 복사만 하므로 프로필에 따른 추가 비용 없음
+void MAX6921_VFD_Driver::applyTubeProfile(const MAX6921_TubeProfile& tube) {
+    _tube = tube;
+    _numGrids = tube.numGrids < VFD_MAX_GRIDS ? tube.numGrids : VFD_MAX_GRIDS;  // 저장소 용량 (setTubeProfile이 거부하지만 배열 색인 상한으로 유지)
+    _numSegments = tube.numSegments;
+    _frameBytes = tube.frameBytes;
+    _segmentMask = (VFD_SegmentMask)(VFD_GridStore::allSegments >> (VFD_MAX_SEGMENTS - tube.numSegments));
+    
+    _maxBrightness = tube.maxBrightness;
+    if (_nominalBrightness > _maxBrightness) _nominalBrightness = _maxBrightness;
+    if (_brightness > _maxBrightness) _brightness = _maxBrightness;
+    _fading = false;
+    _scanSlot = 0;
+    _currentGrid = 0;
+    buildScanOrder();
+    updateBlankTiming();
+    
+    _glyphs.clear();                      // 글리프 패턴은 튜브별 세그먼트 비트
+    _gridData.clear();
+    memset(_frameBuffers, 0, sizeof(_frameBuffers));
+    _dirtyGrids = (uint16_t)((1UL << _numGrids) - 1);
+    clearBuffer();
+    flushDirtyGrids();
+    resetUpdateStats();
+    memcpy(_front, _back, sizeof(MAX6921_FrameBuffer));
+    memcpy(_ready, _back, sizeof(MAX6921_FrameBuffer));
+    _flipPending = false;
+}
+
+// 튜브 프로필 교체 (NULL이거나 저장소 용량을 넘으면 false, 현재 프로필 유지)
+bool MAX6921_VFD_Driver::setTubeProfile(const MAX6921_TubeProfile* profile) {
+    if (profile == NULL) return false;
+    
+    MAX6921_TubeProfile tube;
+    max6921LoadTubeProfile(profile, &tube);
+    if (tube.numGrids == 0 || tube.numGrids > VFD_MAX_GRIDS ||
+        tube.numSegments == 0 || tube.numSegments > VFD_MAX_SEGMENTS ||
+        tube.frameBytes > VFD_MAX_FRAME_BYTES || tube.frameBytes != MAX6921_CHAIN_BYTES(tube.numChips)) {
+        return false;
+    }
+    
+    applyTubeProfile(tube);
+    return true;
+}
+
+const MAX6921_TubeProfile& MAX6921_VFD_Driver::getTubeProfile() {
+    return _tube;
+}
+
+const char* MAX6921_VFD_Driver::getTubeName() {
+    return _tube.name;
+}
+
+uint8_t MAX6921_VFD_Driver::getNumGrids() {
+    return _numGrids;
+}
+
+uint8_t MAX6921_VFD_Driver::getNumSegments() {
+    return _numSegments;
 }
 
 // Initialize the driver
@@ -33,33 +252,35 @@ bool MAX6921_VFD_Driver::begin() {
     return begin(DEFAULT_SPI_CLOCK_SPEED);
 }
 
+bool MAX6921_VFD_Driver::begin(const MAX6921_TubeProfile* profile, uint32_t spiClockSpeed) {
+    if (!setTubeProfile(profile)) return false;
+    return begin(spiClockSpeed);
+}
+
 bool MAX6921_VFD_Driver::begin(uint32_t spiClockSpeed) {
     // Initialize pins
     initializePins();
     
-    // Initialize SPI
-    SPI.begin();
-    SPI.setDataMode(SPI_MODE0);
-    SPI.setBitOrder(MSBFIRST);
-    
-    // Set SPI clock speed
-    if (spiClockSpeed > 8000000) spiClockSpeed = 8000000; // Max 8MHz for MAX6921
+    // Initialize chain transport (LOAD 핀 포함)
+    _spiTransport.setClockSpeed(spiClockSpeed);
+    _transport->begin();
     
-    // Test communication
+    // 체인 전체(프로필 칩 수 x 20비트)를 0으로 래치 (전원 투입 시 임의 출력 제거)
     clear();
-    sendData(0, 0);
+    uint8_t zeroFrame[VFD_MAX_FRAME_BYTES];
+    memset(zeroFrame, 0, sizeof(zeroFrame));
+    _transport->send(zeroFrame, _frameBytes);
     
+    _lastGridScan = micros();             // 첫 슬롯을 늦은 슬롯으로 세지 않음
     return true;
 }
 
 // Initialize hardware pins
 void MAX6921_VFD_Driver::initializePins() {
-    // Configure pins as outputs
-    pinMode(_loadPin, OUTPUT);
+    // LOAD 핀은 전송 계층에서 설정
     pinMode(_blankPin, OUTPUT);
     
     // Set initial states
-    digitalWrite(_loadPin, HIGH);     // LOAD inactive (active low)
     digitalWrite(_blankPin, LOW);     // Display enabled (BLANK is active high, so LOW = display on)
 }
 
@@ -69,149 +290,991 @@ void MAX6921_VFD_Driver::sendData(uint32_t data1, uint32_t data2) {
 }
 
 // 자동 마스킹을 적용하여 데이터 전송
+// data1 = MAX6921 #1 (MCU 쪽), data2 = MAX6921 #2 (체인 끝)
 void MAX6921_VFD_Driver::sendDataWithMask(uint32_t data1, uint32_t data2) {
     // 사용하지 않는 비트를 0으로 마스킹
-    uint32_t maskedData1 = applyChip1Mask(data1);
-    uint32_t maskedData2 = applyChip2Mask(data2);
+    uint32_t words[2] = { applyChip1Mask(data1), applyChip2Mask(data2) };
     
-    // Begin SPI transaction
-    SPI.beginTransaction(SPISettings(DEFAULT_SPI_CLOCK_SPEED, MSBFIRST, SPI_MODE0));
+    // 체인 끝(#2)부터 40비트를 5바이트로 연속 전송
+    uint8_t frame[MAX6921_CHAIN_BYTES(2)];
+    max6921PackChain(words, 2, frame);
+    _transport->send(frame, sizeof(frame));
+}
+
+// 미리 계산된 그리드 프레임 전송 (비트 연산 없이 바이트만 순서대로 전송)
+void MAX6921_VFD_Driver::sendFrame(const uint8_t* frame) {
+    MAX6921_PROFILE_START(start);
+    _transport->send(frame, _frameBytes);
+    MAX6921_PROFILE_STOP(MAX6921_STAGE_TRANSFER, start);
+}
+
+// 그리드 1개의 전송 프레임을 다시 계산
+//
+// 체인 비트 배치는 튜브 프로필의 출력 맵(연결 테이블에서 생성, PROGMEM)을 따름:
+//   gridFrame[grid]            : 그리드 선택 비트만 켜진 프레임
+//   segmentFrameByte/Mask      : 세그먼트별 프레임 바이트 위치와 마스크
+//   프레임 형식은 MAX6921_Transport.h 참조 (칩 수에 관계없이 동일)
+//
+// back 버퍼에만 기록하므로 스캔 ISR과 경쟁하지 않음 (표시는 present() 이후)
+void MAX6921_VFD_Driver::encodeGrid(uint8_t grid) {
+    if (grid >= _numGrids) return;
     
-    // Set LOAD pin low (common for all chips)
-    digitalWrite(_loadPin, LOW);
+    uint8_t* frame = _back->frames[grid];
+    memcpy_P(frame, _tube.gridFrame + grid * _frameBytes, _frameBytes);
     
-    // Send 20-bit data to each chip (3 bytes)
-    // MAX6921 #1
-    SPI.transfer((maskedData1 >> 16) & 0x0F);  // Upper 4 bits
-    SPI.transfer((maskedData1 >> 8) & 0xFF);   // Middle 8 bits
-    SPI.transfer(maskedData1 & 0xFF);          // Lower 8 bits
+    VFD_SegmentMask segments = _gridData.get(grid) & _segmentMask;
+    for (uint8_t seg = 0; segments != 0; seg++, segments >>= 1) {
+        if (segments & 1) {
+            frame[pgm_read_byte(&_tube.segmentFrameByte[seg])] |= pgm_read_byte(&_tube.segmentFrameMask[seg]);
+        }
+    }
+}
+
+// Clear display
+void MAX6921_VFD_Driver::clear() {
+    clearBuffer();
+    autoPresent();
+}
+
+void MAX6921_VFD_Driver::clearBuffer() {
+    for (uint8_t i = 0; i < _numGrids; i++) {
+        setGridData(i, 0);
+        _displayBuffer[i] = ' ';
+        _displayMarks[i] = 0;
+    }
+}
+
+// back 버퍼를 표시 대기 화면으로 넘김
+// 실제 교체는 스캔이 그리드 0으로 돌아올 때 일어나므로 한 프레임 안에서
+// 이전 화면과 새 화면이 섞이지 않음. 표시 전에 다시 present()하면 최신 화면으로 대체됨
+void MAX6921_VFD_Driver::present() {
+    // 바뀐 그리드가 없으면 넘길 화면도 없음
+    if (_dirtyGrids == 0) {
+        _lastRebuildCount = 0;
+        return;
+    }
     
-    // MAX6921 #2
-    SPI.transfer((maskedData2 >> 16) & 0x0F);  // Upper 4 bits
-    SPI.transfer((maskedData2 >> 8) & 0xFF);   // Middle 8 bits
-    SPI.transfer(maskedData2 & 0xFF);          // Lower 8 bits
+    flushDirtyGrids();
     
-    // Set LOAD pin high to latch data (common for all chips)
-    digitalWrite(_loadPin, HIGH);
+    MAX6921_FrameBuffer* presented;
     
-    // End SPI transaction
-    SPI.endTransaction();
+    MAX6921_ATOMIC_BEGIN();
+    presented = _back;
+    _back = _ready;
+    _ready = presented;
+    _flipPending = true;
+    MAX6921_ATOMIC_END();
+    
+    // 새 back 버퍼를 방금 넘긴 화면과 같게 맞춤
+    // (presented는 이후 _ready 또는 _front가 되지만 내용은 바뀌지 않음)
+    memcpy(_back, presented, sizeof(MAX6921_FrameBuffer));
 }
 
-// Clear display
-void MAX6921_VFD_Driver::clear() {
-    for (int i = 0; i < _numGrids; i++) {
-        _gridData[i] = 0;
+// 그리드 데이터 변경 (같은 값이면 아무 것도 하지 않음)
+void MAX6921_VFD_Driver::setGridData(uint8_t grid, VFD_SegmentMask segmentMask) {
+    if (_gridData.set(grid, segmentMask)) {
+        _dirtyGrids |= (uint16_t)(1U << grid);
     }
-    for (int i = 0; i < _numGrids; i++) {
-        _displayBuffer[i] = ' ';
+}
+
+// dirty 그리드만 back 버퍼 프레임으로 인코딩
+void MAX6921_VFD_Driver::flushDirtyGrids() {
+    uint8_t rebuilt = 0;
+    uint16_t dirty = _dirtyGrids;
+    
+    for (uint8_t grid = 0; dirty != 0; grid++, dirty >>= 1) {
+        if (dirty & 1) {
+            MAX6921_PROFILE_START(start);
+            encodeGrid(grid);
+            MAX6921_PROFILE_STOP(MAX6921_STAGE_ENCODE, start);
+            rebuilt++;
+        }
+    }
+    
+    _dirtyGrids = 0;
+    _lastRebuildCount = rebuilt;
+    _totalRebuildCount += rebuilt;
+}
+
+uint8_t MAX6921_VFD_Driver::getLastRebuildCount() {
+    return _lastRebuildCount;
+}
+
+uint32_t MAX6921_VFD_Driver::getTotalRebuildCount() {
+    return _totalRebuildCount;
+}
+
+uint32_t MAX6921_VFD_Driver::getFontLookupCount() {
+    return _fontLookupCount;
+}
+
+void MAX6921_VFD_Driver::resetUpdateStats() {
+    _lastRebuildCount = 0;
+    _totalRebuildCount = 0;
+    _fontLookupCount = 0;
+}
+
+void MAX6921_VFD_Driver::setAutoPresent(bool enable) {
+    _autoPresent = enable;
+}
+
+bool MAX6921_VFD_Driver::isFlipPending() {
+    return _flipPending;
+}
+
+void MAX6921_VFD_Driver::autoPresent() {
+    if (_autoPresent) {
+        present();
     }
 }
 
 // Refresh display (call regularly in main loop)
+// 타이머 스캔 모드에서는 ISR이 스캔을 담당하므로 효과 진행만 수행
+//
+// 폴링 모드의 그리드 슬롯:
+//   BLANK ON → (lead) → 프레임 전송 + LOAD → (trail) → BLANK OFF → (표시 시간 경과) → BLANK ON
+// lead/trail 대기는 블로킹하지 않고 다음 refresh() 호출에서 이어감 (가드가 0이면 한 번에 진행)
+// 표시 시간 판정 정밀도는 refresh() 호출 빈도에 따름
 void MAX6921_VFD_Driver::refresh() {
+    _effects.update();                    // 효과는 foreground에서만 진행 (등록된 효과가 없으면 즉시 반환)
+    
+    if (_frameDone) {
+        _frameDone = false;
+        updateScanRate();                 // 목표 화면 주파수 모드 (타이머 모드 포함)
+    }
+    
+    if (_timerScan) return;
+    
     unsigned long currentTime = micros();
+    unsigned long elapsed = currentTime - _lastGridScan;
     
-    if (currentTime - _lastGridScan >= _gridScanDelay) {
-        // Move to next grid
-        _currentGrid = (_currentGrid + 1) % VFD_NUM_GRIDS;
+    if (elapsed >= _gridScanDelay) {
+        setBlank(true);
         
-        // Calculate data for current grid
-        uint32_t gridPattern = (1UL << _currentGrid);
-        uint64_t segmentData = _gridData[_currentGrid];
+        // BLANK 예약 구간보다 늦게 시작하면 그 그리드의 표시 시간이 줄어듦
+        unsigned long late = elapsed - _gridScanDelay;
+        if (late > _scanReserveUs) _missedDeadlines++;
         
-        // Generic data transmission - specific bit mapping should be handled 
-        // by VFD config or external mapping functions
-        // For now, send raw data (this needs to be customized per VFD)
-        uint32_t data1 = gridPattern | (uint32_t)(segmentData & 0xFFFFF);  // Grid + lower 20 bits
-        uint32_t data2 = (uint32_t)((segmentData >> 20) & 0xFFFFF);       // Upper bits
+        // 목표 주파수 모드: 예정 시각 기준으로 이어가서 늦은 시간이 화면 주기에 쌓이지 않게 함
+        // (한 슬롯 이상 늦으면 현재 시각으로 다시 맞춤)
+        if (_targetFrameRate != 0 && late < _gridScanDelay) {
+            _lastGridScan += _gridScanDelay;
+            elapsed = late;
+        } else {
+            _lastGridScan = currentTime;
+            elapsed = 0;
+        }
+        _scanPhase = SCAN_LEAD;
+    }
+    
+    if (_scanPhase == SCAN_LEAD) {
+        if (elapsed < _blankLeadUs) return;
         
-        // Send to MAX6921 chips
-        sendData(data1, data2);
+        // BLANK 해제는 프레임이 래치된 뒤 전송 완료 콜백에서 수행 (trail이 있으면 SCAN_TRAIL로)
+        // (동기 전송은 scanNextGrid() 안에서 바로 호출됨)
+        _scanPhase = SCAN_LATCH;
+        _releaseOnLatch = true;
+        scanNextGrid();
+    }
+    
+    if (_scanPhase == SCAN_TRAIL) {
+        if ((unsigned long)(micros() - _latchTime) < _blankTrailUs) return;
         
-        _lastGridScan = currentTime;
+        _scanPhase = SCAN_SHOW;
+        if (_gridOnTimeUs[_currentGrid] > 0) {
+            setBlank(false);
+        }
+    } else if (_scanPhase == SCAN_SHOW && !_blanked &&
+               (unsigned long)(micros() - _latchTime) >= (unsigned long)_blankTrailUs + _gridOnTimeUs[_currentGrid]) {
+        // 표시 구간은 래치 시각부터 (비동기 전송 시간만큼 표시 시간이 줄지 않게)
+        setBlank(true);
+    }
+}
+
+// 다음 그리드로 이동하여 해당 그리드 데이터를 전송
+// refresh()(폴링 모드)와 scanISR()(타이머 모드)이 공유하는 스캔 핫패스
+void MAX6921_VFD_Driver::scanNextGrid() {
+    MAX6921_PROFILE_START(start);
+    
+    // 프레임은 present() 시 변경된 그리드만 미리 계산됨
+    const uint8_t* frame = advanceScan();
+    if (_targetFrameRate != 0) {
+        _transferStart = micros();        // 전송 완료 콜백에서 전송 시간 측정
+    }
+    sendFrame(frame);
+    
+#ifdef MAX6921_PROFILE
+    uint32_t elapsed = MAX6921_PROFILE_CLOCK() - start;
+    profileRecord(MAX6921_STAGE_GRID, elapsed);
+    _profileFrameTime += elapsed;
+#endif
+}
+
+// 다음 그리드 선택 (스캔 순서 테이블 기준, 프레임 경계에서 페이드 진행 + 페이지 플립)
+const uint8_t* MAX6921_VFD_Driver::advanceScan() {
+    // Move to next slot
+    uint8_t slot = _scanSlot + 1;
+    if (slot >= _numGrids) {
+        slot = 0;
+        
+        // 화면 주기 (지수 평균 1/8) + 직전 화면의 최대 전송 시간
+        unsigned long now = micros();
+        if (_frameCount > 0) {
+            uint32_t period = now - _frameStart;
+            _framePeriodUs = (_framePeriodUs == 0) ? period : _framePeriodUs - (_framePeriodUs >> 3) + (period >> 3);
+        }
+        _frameStart = now;
+        _frameCount++;
+        _transferTimeUs = _frameTransferUs;
+        _frameTransferUs = 0;
+        _frameDone = true;
+#ifdef MAX6921_PROFILE
+        // 직전 화면의 그리드 스캔 시간 합 기록
+        if (_profileFrameTime > 0) profileRecord(MAX6921_STAGE_FRAME, _profileFrameTime);
+        _profileFrameTime = 0;
+#endif
+        updateFade();  // 페이드는 프레임 경계에서만 진행
+        
+        // 페이지 플립: 완성된 화면이 대기 중이면 프레임 경계에서 교체
+        if (_flipPending) {
+            MAX6921_FrameBuffer* shown = _front;
+            _front = _ready;
+            _ready = shown;
+            _flipPending = false;
+        }
+    }
+    _scanSlot = slot;
+    uint8_t grid = _scanOrder[slot];
+    _currentGrid = grid;
+    
+    return _front->frames[grid];
+}
+
+uint8_t MAX6921_VFD_Driver::getLoadPin() {
+    return _loadPin;
+}
+
+// 타이머 ISR 본체: 그리드 1개 스캔 + 최악 소요 시간 기록
+void MAX6921_VFD_Driver::scanISR() {
+    unsigned long start = micros();
+    
+#if MAX6921_HAS_SCAN_TIMER
+    // 실행 중 주기 변경 2단계: 새 TOP 기준 비교 값이 이번 BOTTOM에 적용됐으므로 TOP도 바꿈
+    // (ICR1은 버퍼가 없어 BOTTOM 직후 이 시점에 써야 함, 카운터는 아직 새 TOP보다 훨씬 작음)
+    if (_armedTimerTop != 0) {
+        ICR1 = _armedTimerTop;
+        _timerTop = _armedTimerTop;
+        _armedTimerTop = 0;
+    }
+#endif
+    
+    if (!_blankHardwarePwm) {
+        setBlank(true);
+    }
+    
+    // lead 가드: 이전 그리드 출력이 꺼질 때까지 LOAD를 미룸 (하드웨어 PWM은 BOTTOM에서 이미 BLANK)
+    // ISR 안의 대기는 MAX6921_TIMER_MAX_LEAD_US로 제한 (다른 인터럽트가 그만큼만 밀림)
+    // 남는 lead는 표시 시간 계산에 그대로 포함되어 LOAD 뒤 BLANK 구간으로 남음
+    uint16_t lead = _blankLeadUs;
+    if (lead > MAX6921_TIMER_MAX_LEAD_US) lead = MAX6921_TIMER_MAX_LEAD_US;
+    if (lead > 0) {
+        delayMicroseconds(lead);
+    }
+    
+    _releaseOnLatch = false;              // 타이머 모드의 BLANK 해제는 COMPB에서
+    scanNextGrid();
+    
+    // OCR1x는 다음 BOTTOM에서 적용되므로 다음 슬롯에 표시될 그리드 기준으로 설정
+    // 주기 변경 1단계: 다음 슬롯 비교 값을 새 TOP 기준으로 계산하고 TOP은 다음 ISR에서 적용
+#if MAX6921_HAS_SCAN_TIMER
+    uint16_t nextTop = _timerTop;
+    if (_pendingTimerTop != 0) {
+        nextTop = _pendingTimerTop;
+        _armedTimerTop = nextTop;
+        _pendingTimerTop = 0;
+    }
+    uint8_t next = _scanSlot + 1;
+    if (next >= _numGrids) next = 0;
+    uint16_t compare = blankCompareValue(_scanOrder[next], nextTop);
+    OCR1A = compare;
+    OCR1B = compare;
+#endif
+    
+    uint16_t elapsed = (uint16_t)(micros() - start);
+    if (elapsed > _maxScanTimeUs) {
+        _maxScanTimeUs = elapsed;
+    }
+    if (elapsed > _scanReserveUs + lead) {
+        _missedDeadlines++;               // 전송 + LOAD가 BLANK 예약 구간을 넘음
+    }
+}
+
+// 타이머 ISR 본체: BLANK 구간 종료 (소프트웨어 PWM 경로)
+// 비동기 전송이 아직 끝나지 않았으면 래치 직후로 미룸 (이전 그리드 데이터 노출 방지)
+void MAX6921_VFD_Driver::blankReleaseISR() {
+    if (_blankHardwarePwm) return;
+    
+    if (_transport->isBusy()) {
+        _releaseOnLatch = true;
+    } else {
+        setBlank(false);
+    }
+}
+
+// 전송 완료 콜백: 예약된 BLANK 해제 수행
+// 폴링 모드에서 trail 가드가 있으면 해제는 refresh()가 trail 경과 후 수행
+// (타이머 모드의 trail은 슬롯 앞 BLANK 구간에 포함되어 비교 일치 시점이 이미 그 뒤임)
+void MAX6921_VFD_Driver::onTransferComplete() {
+    if (_transferStart != 0) {
+        uint16_t transfer = (uint16_t)(micros() - _transferStart);
+        if (transfer > _frameTransferUs) _frameTransferUs = transfer;
+        _transferStart = 0;
+    }
+    
+    if (!_releaseOnLatch) return;
+    
+    _releaseOnLatch = false;
+    if (!_timerScan) {
+        _latchTime = micros();
+        if (_blankTrailUs > 0) {
+            _scanPhase = SCAN_TRAIL;
+            return;
+        }
+    }
+    
+    _scanPhase = SCAN_SHOW;
+    if (_gridOnTimeUs[_currentGrid] > 0) {
+        setBlank(false);
+    }
+}
+
+void MAX6921_VFD_Driver::transferCompleteCallback(void* context) {
+    static_cast<MAX6921_VFD_Driver*>(context)->onTransferComplete();
+}
+
+// 하드웨어 타이머 스캔 시작
+// gridPeriodUs 마다 ISR에서 그리드 1개씩 스캔 (loop()의 블로킹과 무관하게 일정한 주기 유지)
+// 같은 타이머로 BLANK PWM도 생성하므로 밝기 제어가 스캔과 정확히 동기화됨
+// 지원하지 않는 보드에서는 false를 반환하며, 이 경우 refresh() 폴링을 계속 사용해야 함
+bool MAX6921_VFD_Driver::beginTimerScan(uint16_t gridPeriodUs) {
+#if MAX6921_HAS_SCAN_TIMER
+    uint32_t ticks = (uint32_t)gridPeriodUs * MAX6921_TIMER1_TICKS_PER_US;
+    if (ticks < 2 || ticks > 65535UL) return false;
+    
+    uint8_t pwmTimer = digitalPinToTimer(_blankPin);
+    
+    noInterrupts();
+    _gridScanDelay = gridPeriodUs;
+    _timerTop = (uint16_t)(ticks - 1);
+    _pendingTimerTop = 0;
+    _armedTimerTop = 0;
+    _scanTimerInstance = this;
+    updateBlankTiming();
+    
+    TCCR1A = 0;
+    TCCR1B = 0;
+    TCNT1 = 0;
+    ICR1 = _timerTop;
+    OCR1A = blankCompareValue(0, _timerTop);
+    OCR1B = OCR1A;
+    
+    // Fast PWM 비반전 출력: BOTTOM에서 HIGH(BLANK), 비교 일치에서 LOW(표시)
+    _blankHardwarePwm = true;
+    if (pwmTimer == TIMER1A) {
+        TCCR1A = _BV(COM1A1) | _BV(WGM11);
+    } else if (pwmTimer == TIMER1B) {
+        TCCR1A = _BV(COM1B1) | _BV(WGM11);
+    } else {
+        TCCR1A = _BV(WGM11);
+        _blankHardwarePwm = false;
+    }
+    TCCR1B = _BV(WGM13) | _BV(WGM12) | _BV(CS11);  // Fast PWM 모드 14, 프리스케일러 8
+    
+    TIFR1 = _BV(TOV1) | _BV(OCF1B);
+    TIMSK1 |= _BV(TOIE1);
+    if (!_blankHardwarePwm) {
+        TIMSK1 |= _BV(OCIE1B);
+    }
+    _timerScan = true;
+    interrupts();
+    
+    return true;
+#else
+    (void)gridPeriodUs;
+    return false;
+#endif
+}
+
+// 하드웨어 타이머 스캔 중지 (이후 refresh() 폴링 모드로 복귀)
+void MAX6921_VFD_Driver::endTimerScan() {
+#if MAX6921_HAS_SCAN_TIMER
+    noInterrupts();
+    TIMSK1 &= ~(_BV(TOIE1) | _BV(OCIE1B));
+    TCCR1A = 0;
+    TCCR1B = 0;
+    _timerScan = false;
+    _blankHardwarePwm = false;
+    if (_scanTimerInstance == this) _scanTimerInstance = NULL;
+    interrupts();
+    
+    setBlank(true);
+    _lastGridScan = micros();             // 폴링 모드 첫 슬롯을 늦은 슬롯으로 세지 않음
+#endif
+}
+
+bool MAX6921_VFD_Driver::isTimerScanActive() {
+    return _timerScan;
+}
+
+uint16_t MAX6921_VFD_Driver::getMaxScanTimeUs() {
+    return _maxScanTimeUs;
+}
+
+void MAX6921_VFD_Driver::resetScanStats() {
+    MAX6921_ATOMIC_BEGIN();
+    _maxScanTimeUs = 0;
+    _missedDeadlines = 0;
+    _framePeriodUs = 0;
+    _frameCount = 0;
+    MAX6921_ATOMIC_END();
+}
+
+// 목표 화면 주파수 설정 (0이면 끄고 현재 그리드 주기 유지)
+void MAX6921_VFD_Driver::setTargetFrameRate(uint16_t hz) {
+    _targetFrameRate = hz;
+    if (hz == 0) {
+        _frameRateLimited = false;
+        return;
+    }
+    updateScanRate();
+}
+
+uint16_t MAX6921_VFD_Driver::getTargetFrameRate() {
+    return _targetFrameRate;
+}
+
+bool MAX6921_VFD_Driver::isFrameRateLimited() {
+    return _frameRateLimited;
+}
+
+uint16_t MAX6921_VFD_Driver::getAchievedFrameRate() {
+    uint32_t period = getFramePeriodUs();
+    if (period == 0) return 0;
+    return (uint16_t)((1000000UL + period / 2) / period);
+}
+
+uint32_t MAX6921_VFD_Driver::getFramePeriodUs() {
+    MAX6921_ATOMIC_BEGIN();
+    uint32_t period = _framePeriodUs;
+    MAX6921_ATOMIC_END();
+    return period;
+}
+
+uint32_t MAX6921_VFD_Driver::getScanFrameCount() {
+    MAX6921_ATOMIC_BEGIN();
+    uint32_t count = _frameCount;
+    MAX6921_ATOMIC_END();
+    return count;
+}
+
+uint32_t MAX6921_VFD_Driver::getMissedDeadlineCount() {
+    MAX6921_ATOMIC_BEGIN();
+    uint32_t count = _missedDeadlines;
+    MAX6921_ATOMIC_END();
+    return count;
+}
+
+uint16_t MAX6921_VFD_Driver::getTransferTimeUs() {
+    return _transferTimeUs;
+}
+
+// 목표 화면 주파수 → 그리드 주기 (foreground, 화면마다 한 번)
+//   그리드 주기 = 1초 / (주파수 x 그리드 수)
+//   BLANK 예약 = 측정한 최대 전송 시간 + 여유 (최소 DEFAULT_BLANK_GUARD_US)
+// 주기가 예약 + 가드 + 최소 표시 구간보다 짧으면 그 값으로 늘리고 isFrameRateLimited()로 알림.
+// 값이 바뀔 때만 적용하므로 평소에는 비교 몇 번뿐
+void MAX6921_VFD_Driver::updateScanRate() {
+    if (_targetFrameRate == 0 || _numGrids == 0) return;
+    
+    // 예약은 전송 시간이 늘면 바로 늘리고, 여유만큼 더 줄었을 때만 줄임 (측정 흔들림으로 주기가 바뀌지 않게)
+    uint32_t reserve = (uint32_t)_transferTimeUs + MAX6921_TRANSFER_MARGIN_US;
+    if (reserve < DEFAULT_BLANK_GUARD_US) reserve = DEFAULT_BLANK_GUARD_US;
+    if (reserve < _scanReserveUs && reserve + MAX6921_TRANSFER_MARGIN_US > _scanReserveUs) reserve = _scanReserveUs;
+    
+    uint32_t period = 1000000UL / ((uint32_t)_targetFrameRate * _numGrids);
+    uint32_t minPeriod = reserve + _blankLeadUs + _blankTrailUs + MAX6921_MIN_DISPLAY_US;
+    _frameRateLimited = (period < minPeriod);
+    if (_frameRateLimited) period = minPeriod;
+    if (period > 0xFFFF) period = 0xFFFF;
+    
+    bool reserveChanged = (reserve != _scanReserveUs);
+    _scanReserveUs = (uint16_t)reserve;
+    
+    if (period != _gridScanDelay) {
+        applyGridPeriod((uint16_t)period);
+    } else if (reserveChanged) {
+        updateBlankTiming();
     }
 }
 
 // Set brightness (0-255)
+// BLANK 핀 PWM으로 구현: 그리드 슬롯 중 표시 구간 길이를 감마 보정된 밝기에 비례하게 조정
 void MAX6921_VFD_Driver::setBrightness(uint8_t brightness) {
-    _brightness = brightness;
+    if (brightness > _maxBrightness) brightness = _maxBrightness;
     
-    // TODO: Implement PWM brightness control using BLANK pins
-    // For now, just store the value
+    MAX6921_ATOMIC_BEGIN();
+    _fading = false;
+    _nominalBrightness = brightness;
+    _brightness = brightness;
+    MAX6921_ATOMIC_END();
+    updateBlankTiming();
 }
 
 uint8_t MAX6921_VFD_Driver::getBrightness() {
     return _brightness;
 }
 
+// 그리드별 드웰 보정
+// 필라멘트 전위 차이 등으로 특정 그리드가 밝거나 어두울 때 표시 시간을 비율로 줄여 맞춤
+void MAX6921_VFD_Driver::setGridDwellTrim(uint8_t grid, uint8_t trim) {
+    if (grid >= _numGrids) return;
+    
+    _gridDwellTrim[grid] = trim;
+    updateBlankTiming();
+}
+
+// 그리드별 표시 시간 재계산 (밝기, 드웰 보정, 효과 레벨, 스캔 주기, BLANK 가드 변경 시)
+// 스캔 핫패스는 이 테이블만 읽음
+void MAX6921_VFD_Driver::updateBlankTiming() {
+    uint16_t onTimes[VFD_MAX_GRIDS];
+    computeGridOnTimes(_gridScanDelay, onTimes);
+    
+    for (uint8_t i = 0; i < _numGrids; i++) {
+        MAX6921_ATOMIC_BEGIN();
+        _gridOnTimeUs[i] = onTimes[i];
+        MAX6921_ATOMIC_END();
+    }
+}
+
+// 그리드 주기 periodUs 기준 그리드별 표시 시간 계산 (멤버 테이블은 바꾸지 않음)
+void MAX6921_VFD_Driver::computeGridOnTimes(uint16_t periodUs, uint16_t* onTimes) {
+    uint32_t guard = (uint32_t)_scanReserveUs + _blankLeadUs + _blankTrailUs;
+    uint16_t usable = (periodUs > guard) ? (uint16_t)(periodUs - guard) : 0;
+    uint32_t onTime = ((uint32_t)usable * max6921BrightnessToDuty(_brightness, _maxBrightness)) >> 16;
+    
+    for (uint8_t i = 0; i < _numGrids; i++) {
+        onTimes[i] = (uint16_t)((onTime * _gridDwellTrim[i] * _gridEffectLevel[i]) / (255UL * 255UL));
+    }
+}
+
+// 고스팅 방지 BLANK 가드 설정
+// 폴링 모드: BLANK 후 lead가 지나야 프레임을 보내고, LOAD 후 trail이 지나야 BLANK를 해제
+// 타이머 모드: lead는 ISR 안에서 대기하고(MAX6921_TIMER_MAX_LEAD_US까지), trail은 슬롯 앞 BLANK 구간을 늘려 보장
+void MAX6921_VFD_Driver::setBlankGuard(uint16_t leadUs, uint16_t trailUs) {
+    MAX6921_ATOMIC_BEGIN();
+    _blankLeadUs = leadUs;
+    _blankTrailUs = trailUs;
+    MAX6921_ATOMIC_END();
+    updateBlankTiming();                  // 타이머 모드는 다음 슬롯의 비교 값부터 적용
+}
+
+uint16_t MAX6921_VFD_Driver::getBlankLeadUs() {
+    return _blankLeadUs;
+}
+
+uint16_t MAX6921_VFD_Driver::getBlankTrailUs() {
+    return _blankTrailUs;
+}
+
+// 스캔 순서 변경 (다음 프레임부터 적용, 현재 슬롯 번호는 유지)
+void MAX6921_VFD_Driver::setScanOrder(uint8_t order) {
+    if (order > MAX6921_SCAN_INTERLEAVED) order = MAX6921_SCAN_SEQUENTIAL;
+    
+    MAX6921_ATOMIC_BEGIN();
+    _scanOrderMode = order;
+    buildScanOrder();
+    MAX6921_ATOMIC_END();
+}
+
+uint8_t MAX6921_VFD_Driver::getScanOrder() {
+    return _scanOrderMode;
+}
+
+// 슬롯 → 그리드 테이블 생성 (스캔 핫패스는 테이블 조회 1회)
+void MAX6921_VFD_Driver::buildScanOrder() {
+    uint8_t grids = _numGrids < VFD_MAX_GRIDS ? _numGrids : VFD_MAX_GRIDS;  // 테이블 용량
+    uint8_t slot = 0;
+    
+    if (_scanOrderMode == MAX6921_SCAN_INTERLEAVED) {
+        for (uint8_t grid = 0; grid < grids; grid += 2) _scanOrder[slot++] = grid;
+        for (uint8_t grid = 1; grid < grids; grid += 2) _scanOrder[slot++] = grid;
+    } else {
+        for (uint8_t grid = 0; grid < grids; grid++) _scanOrder[slot++] = grid;
+    }
+}
+
+// 타이머 모드에서 BLANK를 해제할 Timer1 카운트 값
+// 표시 시간이 0이면 TOP보다 큰 값을 돌려주어 비교 일치가 일어나지 않게 함 (슬롯 전체 BLANK)
+uint16_t MAX6921_VFD_Driver::blankCompareValue(uint8_t grid, uint16_t top) {
+#if MAX6921_HAS_SCAN_TIMER
+    uint16_t onTicks = _gridOnTimeUs[grid] * MAX6921_TIMER1_TICKS_PER_US;
+    if (onTicks == 0 || onTicks > top) return 0xFFFF;
+    return top + 1 - onTicks;
+#else
+    (void)grid;
+    (void)top;
+    return 0xFFFF;
+#endif
+}
+
+// BLANK 핀 제어 (BLANK는 active high: HIGH = 모든 출력 끔)
+void MAX6921_VFD_Driver::setBlank(bool blank) {
+    MAX6921_PROFILE_START(start);
+    digitalWrite(_blankPin, blank ? HIGH : LOW);
+    _blanked = blank;
+    _transport->blank(blank);
+    MAX6921_PROFILE_STOP(MAX6921_STAGE_BLANK, start);
+}
+
+// 페이드 시작 (논블로킹: 스캔 프레임마다 조금씩 진행)
+void MAX6921_VFD_Driver::fadeTo(uint8_t brightness, uint16_t durationMs) {
+    if (brightness > _maxBrightness) brightness = _maxBrightness;
+    
+    MAX6921_ATOMIC_BEGIN();
+    if (durationMs == 0) {
+        _brightness = brightness;
+        _fading = false;
+        MAX6921_ATOMIC_END();
+        updateBlankTiming();
+        return;
+    }
+
+    _fadeFrom = _brightness;
+    _fadeTo = brightness;
+    _fadeStartMs = millis();
+    _fadeDurationMs = durationMs;
+    _fading = true;
+    MAX6921_ATOMIC_END();
+}
+
+// setBrightness()로 지정한 밝기까지 0에서부터 페이드 인
+void MAX6921_VFD_Driver::fadeIn(uint16_t durationMs) {
+    fadeTo(0, 0);
+    fadeTo(_nominalBrightness, durationMs);
+}
+
+// 현재 밝기에서 0까지 페이드 아웃 (setBrightness() 값은 유지)
+void MAX6921_VFD_Driver::fadeOut(uint16_t durationMs) {
+    fadeTo(0, durationMs);
+}
+
+bool MAX6921_VFD_Driver::isFading() {
+    return _fading;
+}
+
+// 페이드 진행 (scanNextGrid()에서 프레임마다 1회 호출, ISR 문맥일 수 있음)
+void MAX6921_VFD_Driver::updateFade() {
+    if (!_fading) return;
+    
+    unsigned long elapsed = millis() - _fadeStartMs;
+    if (elapsed >= _fadeDurationMs) {
+        _brightness = _fadeTo;
+        _fading = false;
+    } else {
+        int16_t delta = (int16_t)_fadeTo - (int16_t)_fadeFrom;
+        _brightness = _fadeFrom + (int16_t)((int32_t)delta * (int32_t)elapsed / _fadeDurationMs);
+    }
+    updateBlankTiming();
+}
+
 // Get character pattern from font table
 uint32_t MAX6921_VFD_Driver::getCharacterPattern(char character) {
-    // BlinkTest에서는 문자 표시를 사용하지 않으므로 더미 반환
-    return 0x000000;
+    // 사용자 글리프 슬롯 코드면 캐시 직접 인덱싱, 아니면 프로필 폰트의 ASCII 직접 조회 테이블 (모두 O(1))
+    uint8_t code = (uint8_t)character;
+    uint32_t pattern;
+    if (_glyphs.lookup(code, pattern)) return pattern;
+    
+    uint8_t index = code - MAX6921_TUBE_FONT_FIRST;
+    pattern = (index < MAX6921_TUBE_FONT_SIZE) ? max6921ReadPattern(_tube.font, index) : 0;
+    
+    // 폰트 패턴이 비어 있는 문자는 공백 말고는 모두 미지원 문자
+    if (pattern == 0 && code != ' ') return _fallbackGlyph;
+    return pattern;
+}
+
+uint32_t MAX6921_VFD_Driver::getDigitPattern(uint8_t digit) {
+    if (digit > 9) return 0;
+    return max6921ReadPattern(_tube.digits, digit);
 }
 
 // Display character at position
 void MAX6921_VFD_Driver::displayCharacter(uint8_t position, char character) {
+    drawCharacter(position, character);
+    autoPresent();
+}
+
+void MAX6921_VFD_Driver::drawCharacter(uint8_t position, char character) {
+    // 바이트 = Latin-1 코드 포인트 (등록된 글리프면 슬롯 코드로 바뀜)
+    drawCell(position, (char)_glyphs.cellCode((uint8_t)character), 0);
+}
+
+void MAX6921_VFD_Driver::drawCell(uint8_t position, char character, uint8_t marks) {
     if (!isValidPosition(position)) return;
+    if (cellUnchanged(position, character, marks)) return;
     
+    _fontLookupCount++;
+    MAX6921_PROFILE_START(start);
+    uint32_t pattern = getCharacterPattern(character);
+    MAX6921_PROFILE_STOP(MAX6921_STAGE_FONT_LOOKUP, start);
+    
+    storeCell(position, character, pattern, marks);
+}
+
+// 같은 문자면 폰트 조회와 재인코딩 모두 생략 (구두점만 바뀌었으면 해당 세그먼트만 교체)
+bool MAX6921_VFD_Driver::cellUnchanged(uint8_t position, char character, uint8_t marks) {
+    if (_displayBuffer[position] != (uint8_t)character) return false;
+    if (_displayMarks[position] != marks) setMarks(position, marks);
+    return true;
+}
+
+void MAX6921_VFD_Driver::storeCell(uint8_t position, char character, uint32_t pattern, uint8_t marks) {
     _displayBuffer[position] = character;
+    _displayMarks[position] = marks;
     
-    // TODO: Implement character-to-grid mapping
-    // For now, just store in buffer
-    // Need to map 4 digit positions to 7 grids
+    // 문자 위치 1개 = 그리드 1개
+    setGridData(position, ((VFD_SegmentMask)pattern & _segmentMask) | markSegments(position, marks));
+}
+
+// 이전 표시가 켠 세그먼트만 끄고 새 표시 세그먼트를 켬 (임의 패턴 그리드에도 사용 가능)
+void MAX6921_VFD_Driver::setMarks(uint8_t position, uint8_t marks) {
+    if (position >= VFD_MAX_GRIDS) return;           // 배열 색인 상한 (호출자가 _numGrids로 검사)
+    VFD_SegmentMask segments = _gridData.get(position) & (VFD_SegmentMask)~markSegments(position, _displayMarks[position]);
+    _displayMarks[position] = marks;
+    setGridData(position, segments | markSegments(position, marks));
+}
+
+// 구두점 표시 → 세그먼트 (튜브 설정에서 해당 그리드에 애넌시에이터가 없으면 0)
+VFD_SegmentMask MAX6921_VFD_Driver::markSegments(uint8_t grid, uint8_t marks) {
+    VFD_SegmentMask segments = 0;
+    if ((marks & MAX6921_MARK_DP) && _tube.dpSegment != VFD_NO_SEGMENT && ((_tube.dpGrids >> grid) & 1)) {
+        segments |= (VFD_SegmentMask)((VFD_SegmentMask)1 << _tube.dpSegment);
+    }
+    if ((marks & MAX6921_MARK_COLON) && _tube.colonSegment != VFD_NO_SEGMENT && ((_tube.colonGrids >> grid) & 1)) {
+        segments |= (VFD_SegmentMask)((VFD_SegmentMask)1 << _tube.colonSegment);
+    }
+    return segments;
+}
+
+// 실제로 켜져 있는 구두점 세그먼트 → 표시 (직접 끈 소수점/콜론을 setColon() 등이 다시 켜지 않도록)
+uint8_t MAX6921_VFD_Driver::litMarks(uint8_t grid) {
+    VFD_SegmentMask segments = _gridData.get(grid);
+    uint8_t marks = 0;
+    if (segments & markSegments(grid, MAX6921_MARK_DP)) marks |= MAX6921_MARK_DP;
+    if (segments & markSegments(grid, MAX6921_MARK_COLON)) marks |= MAX6921_MARK_COLON;
+    return marks;
 }
 
 // Display string
 void MAX6921_VFD_Driver::displayString(const char* text) {
-    clear();
-    
-    int len = strlen(text);
-    if (len > VFD_NUM_GRIDS) len = VFD_NUM_GRIDS;
+    // 구두점을 앞 자리에 합쳐 자리별로 배치한 뒤, 위치별로 비교하여 바뀐 자리만 갱신
+    // 애넌시에이터 세그먼트가 없는 프로필은 구두점이 폰트 문자로 자리를 차지
+    MAX6921_TextCell cells[VFD_MAX_GRIDS];
+    max6921LayoutText(text, cells, _numGrids,
+                      (_tube.dpSegment != VFD_NO_SEGMENT) ? _tube.dpGrids : 0,
+                      (_tube.colonSegment != VFD_NO_SEGMENT) ? _tube.colonGrids : 0,
+                      &_glyphs);
     
-    for (int i = 0; i < len; i++) {
-        displayCharacter(i, text[i]);
+    for (uint8_t i = 0; i < _numGrids; i++) {
+        drawCell(i, cells[i].character, cells[i].marks);
     }
+    
+    // 문자열 전체가 그려진 뒤 한 번에 표시
+    autoPresent();
 }
 
 void MAX6921_VFD_Driver::displayString(String text) {
     displayString(text.c_str());
 }
 
+// ===== 사용자 글리프 =====
+
+bool MAX6921_VFD_Driver::defineGlyph(uint16_t codePoint, uint32_t pattern) {
+    if (!_glyphs.define(codePoint, pattern)) return false;
+    refreshGlyphCells();
+    return true;
+}
+
+bool MAX6921_VFD_Driver::defineGlyph(const char* character, uint32_t pattern) {
+    if (character == NULL || *character == '\0') return false;
+    return defineGlyph(max6921DecodeUtf8(character), pattern);
+}
+
+bool MAX6921_VFD_Driver::removeGlyph(uint16_t codePoint) {
+    int8_t slot = _glyphs.find(codePoint);
+    if (slot < 0) return false;
+    releaseGlyphCells((uint8_t)slot);
+    _glyphs.remove(codePoint);
+    refreshGlyphCells();
+    return true;
+}
+
+void MAX6921_VFD_Driver::clearGlyphs() {
+    for (uint8_t slot = 0; slot < MAX6921_GLYPH_CACHE_SIZE; slot++) {
+        releaseGlyphCells(slot);
+    }
+    _glyphs.clear();
+    refreshGlyphCells();
+}
+
+uint8_t MAX6921_VFD_Driver::getGlyphCount() {
+    return _glyphs.getCount();
+}
+
+void MAX6921_VFD_Driver::setFallbackGlyph(uint32_t pattern) {
+    _fallbackGlyph = pattern;
+    refreshGlyphCells();
+}
+
+void MAX6921_VFD_Driver::setFallbackCharacter(char character) {
+    uint8_t index = (uint8_t)character - MAX6921_TUBE_FONT_FIRST;
+    setFallbackGlyph((index < MAX6921_TUBE_FONT_SIZE) ? max6921ReadPattern(_tube.font, index) : 0);
+}
+
+uint32_t MAX6921_VFD_Driver::getFallbackGlyph() {
+    return _fallbackGlyph;
+}
+
+// 슬롯이 나중에 다른 글리프로 재사용되어도 화면의 자리가 섞이지 않도록 자리 문자 코드를 되돌림
+void MAX6921_VFD_Driver::releaseGlyphCells(uint8_t slot) {
+    uint16_t codePoint = _glyphs.getCodePoint(slot);
+    if (codePoint == 0) return;
+    
+    uint8_t slotCode = MAX6921_GLYPH_FIRST_CODE + slot;
+    uint8_t original = (codePoint < 0x80) ? (uint8_t)codePoint : MAX6921_GLYPH_UNKNOWN;
+    for (uint8_t grid = 0; grid < _numGrids; grid++) {
+        if (_displayBuffer[grid] == slotCode) _displayBuffer[grid] = original;
+    }
+}
+
+// 화면의 문자 자리를 현재 글리프/대체 패턴으로 다시 그림 (패턴이 같은 그리드는 dirty가 되지 않음)
+// ASCII 자리는 새로 등록된 덮어쓰기 글리프가 있으면 그 슬롯으로 바뀜
+void MAX6921_VFD_Driver::refreshGlyphCells() {
+    for (uint8_t grid = 0; grid < _numGrids; grid++) {
+        uint8_t code = _displayBuffer[grid];
+        if (code == 0) continue;          // 임의 패턴 그리드
+        if (code < MAX6921_GLYPH_FIRST_CODE) code = _glyphs.cellCode(code);
+        storeCell(grid, (char)code, getCharacterPattern((char)code), _displayMarks[grid]);
+    }
+    autoPresent();
+}
+
 // Display number
 void MAX6921_VFD_Driver::displayNumber(int number) {
-    char buffer[VFD_NUM_GRIDS + 1];
-    snprintf(buffer, sizeof(buffer), "%4d", number);
-    displayString(buffer);
+    drawNumber(number, 0, false);
+    autoPresent();
 }
 
 void MAX6921_VFD_Driver::displayNumber(long number) {
-    char buffer[VFD_NUM_GRIDS + 1];
-    snprintf(buffer, sizeof(buffer), "%4ld", number);
-    displayString(buffer);
+    drawNumber(number, 0, false);
+    autoPresent();
+}
+
+// 고정소수점 표시: displayFixed(1234, 2) → "  12.34"
+void MAX6921_VFD_Driver::displayFixed(long value, uint8_t decimals, bool leadingZeros) {
+    drawNumber(value, decimals, leadingZeros);
+    autoPresent();
 }
 
-// Display floating point number
+// Display floating point number (소수 decimals자리에서 반올림)
 void MAX6921_VFD_Driver::displayFloat(float number, uint8_t decimals) {
-    // TODO: Implement float display with decimal point
-    int intPart = (int)number;
-    displayNumber(intPart);
+    if (decimals > 9) decimals = 9;
+    
+    float scaled = number * (float)pgm_read_dword(&MAX6921_POW10[decimals]);
+    if (!(scaled > -2147483647.0f && scaled < 2147483647.0f)) {
+        drawNumber(MAX6921_NUMBER_OVERFLOW, 0, false);  // 범위 밖 또는 NaN: 자리 넘침 표시
+    } else {
+        drawNumber((int32_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f), decimals, false);
+    }
+    autoPresent();
+}
+
+// 정수 → 자리별 숫자를 오른쪽 정렬로 바로 그리드에 기록
+// 나눗셈 대신 10의 거듭제곱 빼기로 자리값을 구함 (AVR에서 32비트 나눗셈은 자리마다 수백 사이클)
+// 최소 decimals + 1자리 ("0.05"), 자리가 모자라거나 MAX6921_NUMBER_OVERFLOW면 모든 자리에 '-'
+void MAX6921_VFD_Driver::drawNumber(int32_t value, uint8_t decimals, bool leadingZeros) {
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+    
+    uint8_t digits = 1;
+    while (digits < 10 && magnitude >= pgm_read_dword(&MAX6921_POW10[digits])) digits++;
+    if (digits <= decimals) digits = decimals + 1;
+    
+    if (value == MAX6921_NUMBER_OVERFLOW || digits + (negative ? 1 : 0) > _numGrids) {
+        for (uint8_t grid = 0; grid < _numGrids; grid++) drawNumberCell(grid, '-', 0);
+        return;
+    }
+    
+    if (leadingZeros) digits = _numGrids - (negative ? 1 : 0);
+    
+    uint8_t first = _numGrids - digits;                // 가장 높은 자리 그리드
+    uint8_t dpGrid = (decimals > 0) ? _numGrids - 1 - decimals : 0xFF;
+    
+    for (uint8_t grid = 0; grid < first; grid++) {
+        drawNumberCell(grid, (negative && grid == first - 1) ? '-' : ' ', 0);
+    }
+    
+    for (uint8_t grid = first; grid < _numGrids; grid++) {
+        uint8_t place = _numGrids - 1 - grid;              // 10^place 자리
+        uint8_t digit = 0;
+        if (place < 10) {
+            uint32_t power = pgm_read_dword(&MAX6921_POW10[place]);
+            while (magnitude >= power) {
+                magnitude -= power;
+                digit++;
+            }
+        }
+        
+        drawNumberCell(grid, (char)('0' + digit), (grid == dpGrid) ? MAX6921_MARK_DP : 0);
+    }
+}
+
+// 숫자 자리 1개: 덮어쓰기 글리프가 등록된 문자는 displayString()과 같은 슬롯 코드로 기록
+// 등록이 없으면 숫자 전용 테이블 (' '은 조회 없이 빈 패턴)
+void MAX6921_VFD_Driver::drawNumberCell(uint8_t grid, char character, uint8_t marks) {
+    char code = (_glyphs.getCount() != 0) ? (char)_glyphs.cellCode((uint8_t)character) : character;
+    if (cellUnchanged(grid, code, marks)) return;
+    
+    uint32_t pattern = 0;
+    if (code != character) {
+        _fontLookupCount++;
+        pattern = getCharacterPattern(code);
+    } else if (character >= '0' && character <= '9') {
+        _fontLookupCount++;
+        pattern = getDigitPattern(character - '0');
+    } else if (character != ' ') {
+        _fontLookupCount++;
+        pattern = getCharacterPattern(character);
+    }
+    storeCell(grid, code, pattern, marks);
 }
 
 // Test functions
 void MAX6921_VFD_Driver::displayTest() {
     // TODO: Implement comprehensive test
     // Turn on all segments briefly
-    for (int i = 0; i < VFD_NUM_GRIDS; i++) {
-        _gridData[i] = 0x1FFFFF; // All segments on
+    for (int i = 0; i < _numGrids; i++) {
+        setGridData(i, _segmentMask); // All segments on
+        _displayBuffer[i] = 0;
+        _displayMarks[i] = 0;
     }
+    present();
     delay(1000);
     clear();
 }
 
 // Utility functions
 bool MAX6921_VFD_Driver::isValidPosition(uint8_t position) {
-    return position < VFD_NUM_GRIDS;
+    return position < _numGrids;
 }
 
 const char* MAX6921_VFD_Driver::getVersion() {
@@ -219,8 +1282,50 @@ const char* MAX6921_VFD_Driver::getVersion() {
 }
 
 // Configuration
+// 고정 그리드 주기 (목표 화면 주파수 모드를 끄고 BLANK 예약도 기본값으로)
 void MAX6921_VFD_Driver::setGridScanDelay(uint16_t delayMicros) {
-    _gridScanDelay = delayMicros;
+    _targetFrameRate = 0;
+    _frameRateLimited = false;
+    _scanReserveUs = DEFAULT_BLANK_GUARD_US;
+    applyGridPeriod(delayMicros);
+}
+
+void MAX6921_VFD_Driver::applyGridPeriod(uint16_t periodUs) {
+    if (_timerScan) {
+        // 타이머 모드에서는 타이머를 멈추지 않고 주기만 바꿈 (범위 밖이면 현재 주기 유지)
+        if (!retimeTimerScan(periodUs)) _frameRateLimited = true;
+        return;
+    }
+    _gridScanDelay = periodUs;
+    updateBlankTiming();
+}
+
+// 실행 중인 타이머 스캔의 주기 변경 (TCNT1/TCCR1을 건드리지 않음)
+// beginTimerScan()을 다시 부르면 카운터가 0부터 다시 시작해 진행 중인 슬롯이 잘리거나 늘어나므로,
+// 새 TOP은 ISR이 슬롯 경계에 맞춰 적용: 다음 ISR이 새 TOP 기준 비교 값을 버퍼에 넣고
+// 그다음 ISR이 BOTTOM 직후 ICR1을 바꿈. 모든 슬롯이 이전 주기 또는 새 주기 중 하나로 온전히 끝남
+bool MAX6921_VFD_Driver::retimeTimerScan(uint16_t periodUs) {
+#if MAX6921_HAS_SCAN_TIMER
+    uint32_t ticks = (uint32_t)periodUs * MAX6921_TIMER1_TICKS_PER_US;
+    if (ticks < 2 || ticks > 65535UL) return false;
+    
+    // 새 주기의 표시 시간은 미리 계산하고 TOP과 한 번에 교체
+    // (ISR이 새 표시 시간을 이전 TOP과, 또는 그 반대로 섞어 쓰면 한 슬롯이 꺼지거나 밝아짐)
+    uint16_t onTimes[VFD_MAX_GRIDS];
+    computeGridOnTimes(periodUs, onTimes);
+    
+    MAX6921_ATOMIC_BEGIN();
+    _gridScanDelay = periodUs;
+    for (uint8_t i = 0; i < _numGrids; i++) {
+        _gridOnTimeUs[i] = onTimes[i];
+    }
+    _pendingTimerTop = (uint16_t)(ticks - 1);
+    MAX6921_ATOMIC_END();
+    return true;
+#else
+    (void)periodUs;
+    return false;
+#endif
 }
 
 uint16_t MAX6921_VFD_Driver::getGridScanDelay() {
@@ -228,38 +1333,126 @@ uint16_t MAX6921_VFD_Driver::getGridScanDelay() {
 }
 
 // Set segment data for specific grid
+// 세그먼트 수를 넘는 비트는 저장소에서 잘려나감 (64비트 인자는 호환용)
 void MAX6921_VFD_Driver::setGrid(uint8_t grid, uint64_t segmentMask) {
     if (grid < _numGrids) {
-        _gridData[grid] = segmentMask;
+        setGridData(grid, (VFD_SegmentMask)(segmentMask & _segmentMask));
+        _displayBuffer[grid] = 0;  // 문자 캐시 무효화 (임의 패턴)
+        _displayMarks[grid] = 0;
+        autoPresent();
     }
 }
 
+// 그리드 비트맵 일괄 기록 (범위 밖 그리드는 잘라냄)
+void MAX6921_VFD_Driver::setGrids(uint8_t first, const VFD_SegmentMask* masks, uint8_t count) {
+    if (first >= _numGrids) return;
+    if (count > _numGrids - first) count = _numGrids - first;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        setGridData(first + i, masks[i] & _segmentMask);
+        _displayBuffer[first + i] = 0;  // 문자 캐시 무효화 (임의 패턴)
+        _displayMarks[first + i] = 0;
+    }
+    autoPresent();
+}
+
+void MAX6921_VFD_Driver::setGrids_P(uint8_t first, const VFD_SegmentMask* masks, uint8_t count) {
+    if (first >= _numGrids) return;
+    if (count > _numGrids - first) count = _numGrids - first;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        VFD_SegmentMask mask;
+        memcpy_P(&mask, &masks[i], sizeof(mask));
+        setGridData(first + i, mask & _segmentMask);
+        _displayBuffer[first + i] = 0;
+        _displayMarks[first + i] = 0;
+    }
+    autoPresent();
+}
+
+void MAX6921_VFD_Driver::setFrame(const VFD_SegmentMask* masks) {
+    setGrids(0, masks, _numGrids);
+}
+
+void MAX6921_VFD_Driver::setFrame_P(const VFD_SegmentMask* masks) {
+    setGrids_P(0, masks, _numGrids);
+}
+
 // Set individual segment state
+// 세그먼트 비트 연산은 저장소 형(7BT317NK: 32비트)으로 수행
 void MAX6921_VFD_Driver::setSegment(uint8_t grid, uint8_t segment, bool state) {
     if (grid < _numGrids && segment < _numSegments) {
-        if (state) {
-            _gridData[grid] |= (1ULL << segment);  // ULL for 64-bit
-        } else {
-            _gridData[grid] &= ~(1ULL << segment); // ULL for 64-bit
+        if (_gridData.setSegment(grid, segment, state)) {
+            _dirtyGrids |= (uint16_t)(1U << grid);
         }
+        _displayBuffer[grid] = 0;  // 문자 캐시 무효화 (임의 패턴)
+        _displayMarks[grid] = litMarks(grid);
+        autoPresent();
     }
 }
 
+// 전체 자리 마퀴 스크롤 (논블로킹: refresh()에서 진행, 멈추려면 effects().stopAll())
+void MAX6921_VFD_Driver::scrollText(const char* text, uint16_t delayMs) {
+    _effects.marquee(text, 0, _numGrids, delayMs, true);
+}
+
+MAX6921_EffectEngine& MAX6921_VFD_Driver::effects() {
+    return _effects;
+}
+
+void MAX6921_VFD_Driver::setDecimalPoint(uint8_t position, bool state) {
+    if (!isValidPosition(position)) return;
+    
+    uint8_t marks = _displayMarks[position];
+    setMarks(position, state ? (uint8_t)(marks | MAX6921_MARK_DP) : (uint8_t)(marks & ~MAX6921_MARK_DP));
+    autoPresent();
+}
+
+void MAX6921_VFD_Driver::setColon(bool state) {
+    setColon(_tube.clockColonGrid, state);
+}
+
+void MAX6921_VFD_Driver::setColon(uint8_t position, bool state) {
+    if (!isValidPosition(position)) return;
+    
+    uint8_t marks = _displayMarks[position];
+    setMarks(position, state ? (uint8_t)(marks | MAX6921_MARK_COLON) : (uint8_t)(marks & ~MAX6921_MARK_COLON));
+    autoPresent();
+}
+
+// "HH:MM" (두 자리 초과 값은 아래 두 자리만 표시)
+void MAX6921_VFD_Driver::displayTime(uint8_t hours, uint8_t minutes) {
+    char text[6];
+    hours %= 100;
+    minutes %= 100;
+    text[0] = (char)('0' + hours / 10);
+    text[1] = (char)('0' + hours % 10);
+    text[2] = ':';
+    text[3] = (char)('0' + minutes / 10);
+    text[4] = (char)('0' + minutes % 10);
+    text[5] = '\0';
+    displayString(text);
+}
+
 // TODO: Implement remaining methods
-// - setDecimalPoint()
-// - setColon()
-// - displayTime()
 // - segmentTest()
 // - gridTest()
-// - scrollText()
-// - fadeIn()
-// - fadeOut()
 
 // 직접 데이터 전송 함수 (공개 인터페이스)
 void MAX6921_VFD_Driver::sendDataDirect(uint32_t data1, uint32_t data2) {
     sendData(data1, data2);
 }
 
+// 전송 계층 교체
+void MAX6921_VFD_Driver::setTransport(MAX6921_Transport* transport) {
+    _transport = (transport != NULL) ? transport : &_spiTransport;
+    _transport->setTransferCallback(transferCompleteCallback, this);
+}
+
+uint8_t MAX6921_VFD_Driver::getFrameBytes() {
+    return _frameBytes;
+}
+
 // 마스킹 함수들
 uint32_t MAX6921_VFD_Driver::applyChip1Mask(uint32_t data) {
     return data & VFD_CHIP1_VALID_MASK;  // 첫 번째 칩: 20비트 모두 사용
@@ -271,34 +1464,87 @@ uint32_t MAX6921_VFD_Driver::applyChip2Mask(uint32_t data) {
 
 // VFD 설정 정보 함수들 (디버깅용)
 uint8_t MAX6921_VFD_Driver::getTotalBits() {
-    return VFD_TOTAL_BITS;
+    return _numGrids + _numSegments;
 }
 
 uint8_t MAX6921_VFD_Driver::getRequiredChips() {
-    return VFD_REQUIRED_CHIPS;
+    return _tube.numChips;
 }
 
 uint8_t MAX6921_VFD_Driver::getUnusedBits() {
-    return VFD_UNUSED_BITS;
+    return _tube.numChips * MAX6921_OUTPUT_BITS - getTotalBits();
 }
 
 void MAX6921_VFD_Driver::printVFDInfo() {
     Serial.println("=== VFD 설정 정보 ===");
+    Serial.print("튜브 프로필: ");
+    Serial.println((const __FlashStringHelper*)_tube.name);
     Serial.print("VFD 그리드 수: ");
-    Serial.println(VFD_NUM_GRIDS);
+    Serial.println(_numGrids);
     Serial.print("VFD 세그먼트 수: ");
-    Serial.println(VFD_NUM_SEGMENTS);
+    Serial.println(_numSegments);
     Serial.print("총 필요 비트: ");
-    Serial.println(VFD_TOTAL_BITS);
+    Serial.println(getTotalBits());
     Serial.print("필요한 MAX6921 칩 수: ");
-    Serial.println(VFD_REQUIRED_CHIPS);
+    Serial.println(_tube.numChips);
     Serial.print("총 출력 비트: ");
-    Serial.println(VFD_TOTAL_OUTPUT_BITS);
+    Serial.println(_tube.numChips * MAX6921_OUTPUT_BITS);
     Serial.print("사용하지 않는 비트: ");
-    Serial.println(VFD_UNUSED_BITS);
+    Serial.println(getUnusedBits());
     Serial.print("첫 번째 칩 마스크: 0x");
     Serial.println(VFD_CHIP1_VALID_MASK, HEX);
     Serial.print("두 번째 칩 마스크: 0x");
     Serial.println(VFD_CHIP2_VALID_MASK, HEX);
     Serial.println("=====================");
 }
+
+#ifdef MAX6921_PROFILE
+// 측정값 누적 (ISR에서도 호출됨)
+void MAX6921_VFD_Driver::profileRecord(uint8_t stage, uint32_t elapsed) {
+    MAX6921_ProfileCounter& counter = _profile[stage];
+    counter.count++;
+    counter.total += elapsed;
+    if (elapsed > counter.max) counter.max = elapsed;
+}
+
+MAX6921_ProfileCounter MAX6921_VFD_Driver::getProfile(uint8_t stage) {
+    MAX6921_ProfileCounter counter = {0, 0, 0};
+    if (stage >= MAX6921_STAGE_COUNT) return counter;
+    
+    MAX6921_ATOMIC_BEGIN();
+    counter = _profile[stage];
+    MAX6921_ATOMIC_END();
+    return counter;
+}
+
+void MAX6921_VFD_Driver::resetProfile() {
+    MAX6921_ATOMIC_BEGIN();
+    memset(_profile, 0, sizeof(_profile));
+    _profileFrameTime = 0;
+    MAX6921_ATOMIC_END();
+}
+
+const char* MAX6921_VFD_Driver::getProfileStageName(uint8_t stage) {
+    static const char* const stageNames[MAX6921_STAGE_COUNT] = {
+        "font_lookup", "encode", "transfer", "blank", "grid", "frame"
+    };
+    return (stage < MAX6921_STAGE_COUNT) ? stageNames[stage] : "";
+}
+
+// CSV 출력: stage,count,total,avg,max (시간 단위는 MAX6921_PROFILE_CLOCK)
+void MAX6921_VFD_Driver::printProfileCSV() {
+    Serial.println("stage,count,total,avg,max");
+    for (uint8_t stage = 0; stage < MAX6921_STAGE_COUNT; stage++) {
+        MAX6921_ProfileCounter counter = getProfile(stage);
+        Serial.print(getProfileStageName(stage));
+        Serial.print(',');
+        Serial.print(counter.count);
+        Serial.print(',');
+        Serial.print(counter.total);
+        Serial.print(',');
+        Serial.print(counter.count ? counter.total / counter.count : 0);
+        Serial.print(',');
+        Serial.println(counter.max);
+    }
+}
+#endif
@@ -116,6 +116,8 @@ void sendAllData(uint32_t chip1_data, uint32_t chip2_data) {
 #include "VFD_7BT317NK_Config.h"
 #include "MAX6921_VFD_Driver.h"
 #include "VFD_7BT317NK_Font.h"
+#include "VFD_HLD812D_Profile.h"
+#include "MAX6921_SerialProtocol.h"
 
 // Pin assignments for this specific hardware setup
 #define DEFAULT_LOAD_PIN    10   // Common LOAD pin for all MAX6921 chips
@@ -124,26 +126,39 @@ void sendAllData(uint32_t chip1_data, uint32_t chip2_data) {
 MAX6921_VFD_Driver vfd(DEFAULT_LOAD_PIN, DEFAULT_BLANK_PIN, 
                        VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
 
+// 시리얼 수신: 바이너리 프레임(tools/vfd_serial.py) + 시리얼 모니터 텍스트 줄
+// readString()과 달리 블로킹/String 할당 없이 받은 바이트만 해석
+MAX6921_SerialProtocol protocol(&vfd);
+
+// 연결된 튜브 선택 (이름은 각 프로필의 name 필드)
+#define TEST_TUBE_NAME "7BT317NK"
+
+const MAX6921_TubeProfile* const TUBE_PROFILES[] PROGMEM = {
+  &VFD_7BT317NK_PROFILE,
+  &VFD_HLD812D_PROFILE,
+};
+
 void setup() {
-  Serial.begin(9600);
+  Serial.begin(115200);
   Serial.println("=== MAX6921 VFD Driver Test ===");
   
-  vfd.begin();
+  const MAX6921_TubeProfile* tube = max6921FindTubeProfile(
+      TUBE_PROFILES, sizeof(TUBE_PROFILES) / sizeof(TUBE_PROFILES[0]), TEST_TUBE_NAME);
+  vfd.begin(tube ? tube : VFD_DEFAULT_PROFILE);
   vfd.clear();
   
-  Serial.println("텍스트를 입력하세요:");
+  // 타이머 ISR 스캔 사용 (시리얼 처리와 관계없이 스캔 주기 유지)
+  if (!vfd.beginTimerScan()) {
+    Serial.println("타이머 스캔 미지원 - refresh() 폴링 사용");
+  }
+  
+  Serial.println("텍스트를 입력하세요 (줄 끝: CR 또는 LF):");
 }
 
 void loop() {
-  if (Serial.available()) {
-    String text = Serial.readString();
-    text.trim();
-    
-    Serial.print("표시: ");
-    Serial.println(text);
-    
-    vfd.clear();
-    vfd.displayString(text);
-    vfd.refresh();
-  }
+  // 폴링 모드에서만 스캔 수행 (타이머 모드에서는 효과만 진행)
+  vfd.refresh();
+  
+  // 받은 바이트만 해석하고 바로 반환
+  protocol.poll(Serial);
 }
@@ -16,14 +16,43 @@
 #define VFD_7BT317NK_CONFIG_H
 
 #include <Arduino.h>
+#include "VFD_7BT317NK_Map.h"   // 연결 테이블(JSON)에서 생성된 체인 출력 맵
+#include "VFD_7BT317NK_Profile.h"  // 출력 맵 + 폰트 + 애넌시에이터를 묶은 튜브 프로필
 
 // VFD Hardware Specifications
 #define VFD_NUM_GRIDS      7     // G0-G6 (그리드 수 = 자릿수)
 #define VFD_NUM_SEGMENTS   21    // P0-P20 (세그먼트 수)
 #define VFD_MAX_BRIGHTNESS 255   // 최대 밝기 레벨
 
+// 구두점 애넌시에이터 (문자열의 '.'/':'를 앞 자리에 합칠 때 사용, MAX6921_TextLayout.h 참조)
+// 7BT317NK는 자리마다 점 세그먼트(P20) 하나뿐이므로 소수점과 콜론이 같은 세그먼트를 쓴다
+// 애넌시에이터가 없는 튜브는 VFD_NO_SEGMENT로 지정
+#define VFD_DP_SEGMENT        20      // P20: 소수점
+#define VFD_COLON_SEGMENT     20      // P20: 콜론 (폰트의 ':' 패턴과 같음)
+#define VFD_DP_GRIDS          0x7F    // 소수점이 있는 그리드 (bit n = Gn)
+#define VFD_COLON_GRIDS       0x7F    // 콜론이 있는 그리드 (bit n = Gn)
+#define VFD_CLOCK_COLON_GRID  1       // setColon()/displayTime()의 시:분 콜론 (시 둘째 자리)
+
+// 튜브 프로필 (MAX6921_TubeProfile.h 참조)
+// begin()에 프로필을 넘기지 않으면 이 튜브로 동작
+#define VFD_DEFAULT_PROFILE   (&VFD_7BT317NK_PROFILE)
+
+// Note: 드라이버 저장소 용량(VFD_MAX_*)은 MAX6921_Config.h에서 정의됨
 // Note: MAX6921 하드웨어 사양과 비트 계산은 MAX6921_VFD_Driver.h에서 정의됨
 
+// 이 튜브의 체인 출력 맵 (드라이버는 프로필을 통해 참조, 시뮬레이터 등에서 직접 사용 가능)
+// 배선이 바뀌면 vfd-configs/connection-tables/7BT317NK.json 수정 후
+// tools/gen_output_map.py로 VFD_7BT317NK_Map.h를 다시 생성
+#define VFD_MAP_FRAME_BYTES        VFD_7BT317NK_MAP_FRAME_BYTES
+#define VFD_GRID_FRAME             VFD_7BT317NK_GRID_FRAME
+#define VFD_SEGMENT_FRAME_BYTE     VFD_7BT317NK_SEGMENT_FRAME_BYTE
+#define VFD_SEGMENT_FRAME_MASK     VFD_7BT317NK_SEGMENT_FRAME_MASK
+#define VFD_GRID_CHAIN_BIT         VFD_7BT317NK_GRID_CHAIN_BIT
+#define VFD_SEGMENT_CHAIN_BIT      VFD_7BT317NK_SEGMENT_CHAIN_BIT
+
+static_assert(VFD_NUM_GRIDS == VFD_7BT317NK_MAP_GRIDS, "grid count differs from connection table");
+static_assert(VFD_NUM_SEGMENTS == VFD_7BT317NK_MAP_SEGMENTS, "segment count differs from connection table");
+
 // Grid pin assignments for MAX6921 chips
 // G0-G6 are mapped to specific output pins on the MAX6921 chips
 #define VFD_GRID_G0_CHIP    1    // First MAX6921 chip
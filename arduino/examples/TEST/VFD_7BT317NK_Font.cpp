@@ -10,26 +10,32 @@
 
 #include "VFD_7BT317NK_Font.h"
 
+// 폰트 테이블(VFD_7BT317NK_FONT_DENSE/DIGITS/SUPPORTED)은 VFD_7BT317NK_FontTable.cpp에 있음
+// (vfd-configs/font-maps/7BT317NK/font-table.md에서 tools/gen_font_table.py로 생성)
+
 /**
  * Find the pattern for a given character
  * @param ch Character to look up
  * @return 21-bit pattern, or 0 if character not found
  */
 uint32_t getCharacterPattern(char ch) {
-    // Convert to uppercase for consistency
-    if (ch >= 'a' && ch <= 'z') {
-        ch = ch - 'a' + 'A';
+    uint8_t index = (uint8_t)ch - VFD_FONT_FIRST_CHAR;
+    if (index >= VFD_FONT_DENSE_SIZE) {
+        return 0x000000;
     }
-    
-    // Search in font table
-    for (uint8_t i = 0; i < VFD_7BT317NK_FONT_SIZE; i++) {
-        if (VFD_7BT317NK_FONT_TABLE[i].character == ch) {
-            return VFD_7BT317NK_FONT_TABLE[i].pattern;
-        }
+    return max6921ReadPattern(VFD_7BT317NK_FONT_DENSE, index);
+}
+
+/**
+ * Find the pattern for a decimal digit
+ * @param digit Digit value (0-9)
+ * @return 21-bit pattern, or 0 if out of range
+ */
+uint32_t getDigitPattern(uint8_t digit) {
+    if (digit >= 10) {
+        return 0x000000;
     }
-    
-    // Return space pattern if character not found
-    return 0x000000;
+    return max6921ReadPattern(VFD_7BT317NK_FONT_DIGITS, digit);
 }
 
 /**
@@ -38,32 +44,28 @@ uint32_t getCharacterPattern(char ch) {
  * @return true if supported, false otherwise
  */
 bool isCharacterSupported(char ch) {
-    // Convert to uppercase for consistency
-    if (ch >= 'a' && ch <= 'z') {
-        ch = ch - 'a' + 'A';
-    }
-    
-    // Search in font table
-    for (uint8_t i = 0; i < VFD_7BT317NK_FONT_SIZE; i++) {
-        if (VFD_7BT317NK_FONT_TABLE[i].character == ch) {
-            return true;
-        }
+    uint8_t index = (uint8_t)ch - VFD_FONT_FIRST_CHAR;
+    if (index >= VFD_FONT_DENSE_SIZE) {
+        return false;
     }
-    
-    return false;
+    return (pgm_read_byte(&VFD_7BT317NK_FONT_SUPPORTED[index >> 3]) >> (index & 7)) & 1;
 }
 
 /**
  * Print font table to serial for debugging
+ * (플래시 테이블에서 읽으며, 대문자와 같은 소문자는 생략)
  */
 void printFontTable() {
     Serial.println("=== 7BT317NK VFD Font Table ===");
     Serial.println("Char | Pattern (21-bit)     | Hex     ");
     Serial.println("-----|---------------------|----------");
     
-    for (uint8_t i = 0; i < VFD_7BT317NK_FONT_SIZE; i++) {
-        char ch = VFD_7BT317NK_FONT_TABLE[i].character;
-        uint32_t pattern = VFD_7BT317NK_FONT_TABLE[i].pattern;
+    uint8_t count = 0;
+    for (uint8_t code = VFD_FONT_FIRST_CHAR; code < 'a'; code++) {
+        char ch = (char)code;
+        if (!isCharacterSupported(ch)) continue;
+        uint32_t pattern = getCharacterPattern(ch);
+        count++;
         
         // Print character (handle special characters)
         Serial.print(" '");
@@ -93,7 +95,7 @@ void printFontTable() {
     
     Serial.println("===============================");
     Serial.print("Total characters: ");
-    Serial.println(VFD_7BT317NK_FONT_SIZE);
+    Serial.println(count);
 }
 
 /**
@@ -0,0 +1,44 @@
+/*
+ * VFD_7BT317NK_Profile.cpp
+ * 
+ * Tube profile data for 7BT317NK VFD display
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "VFD_7BT317NK_Config.h"
+#include "VFD_7BT317NK_Font.h"
+#include "MAX6921_Transport.h"
+#include "MAX6921_TextLayout.h"
+
+static_assert(VFD_DP_SEGMENT == VFD_NO_SEGMENT || VFD_DP_SEGMENT < VFD_NUM_SEGMENTS, "decimal point segment out of range");
+static_assert(VFD_COLON_SEGMENT == VFD_NO_SEGMENT || VFD_COLON_SEGMENT < VFD_NUM_SEGMENTS, "colon segment out of range");
+static_assert(VFD_FONT_FIRST_CHAR == MAX6921_TUBE_FONT_FIRST && VFD_FONT_DENSE_SIZE == MAX6921_TUBE_FONT_SIZE,
+              "font table layout differs from profile font layout");
+static_assert(VFD_NUM_SEGMENTS <= MAX6921_FONT_MAX_SEGMENTS, "segments do not fit the packed font pattern");
+static_assert(VFD_7BT317NK_MAP_FRAME_BYTES == MAX6921_CHAIN_BYTES(VFD_7BT317NK_MAP_CHIPS), "output map frame size mismatch");
+
+static const char VFD_7BT317NK_PROFILE_NAME[] PROGMEM = "7BT317NK";
+
+const MAX6921_TubeProfile VFD_7BT317NK_PROFILE PROGMEM = {
+    VFD_7BT317NK_PROFILE_NAME,
+    VFD_NUM_GRIDS,
+    VFD_NUM_SEGMENTS,
+    VFD_7BT317NK_MAP_CHIPS,
+    VFD_7BT317NK_MAP_FRAME_BYTES,
+    VFD_MAX_BRIGHTNESS,
+    &VFD_7BT317NK_GRID_FRAME[0][0],
+    VFD_7BT317NK_SEGMENT_FRAME_BYTE,
+    VFD_7BT317NK_SEGMENT_FRAME_MASK,
+    VFD_7BT317NK_GRID_CHAIN_BIT,
+    VFD_7BT317NK_SEGMENT_CHAIN_BIT,
+    VFD_7BT317NK_FONT_DENSE,
+    VFD_7BT317NK_FONT_DIGITS,
+    VFD_DP_SEGMENT,
+    VFD_COLON_SEGMENT,
+    VFD_DP_GRIDS,
+    VFD_COLON_GRIDS,
+    VFD_CLOCK_COLON_GRID
+};
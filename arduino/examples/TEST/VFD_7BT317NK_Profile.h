@@ -0,0 +1,22 @@
+/*
+ * VFD_7BT317NK_Profile.h
+ * 
+ * Tube profile for 7BT317NK VFD display
+ * 연결 테이블 출력 맵, 폰트, 구두점 애넌시에이터를 MAX6921_TubeProfile 하나로 묶음 (PROGMEM)
+ * 
+ *   vfd.begin(&VFD_7BT317NK_PROFILE);
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef VFD_7BT317NK_PROFILE_H
+#define VFD_7BT317NK_PROFILE_H
+
+#include <Arduino.h>
+#include "MAX6921_TubeProfile.h"
+
+extern const MAX6921_TubeProfile VFD_7BT317NK_PROFILE;
+
+#endif // VFD_7BT317NK_PROFILE_H
@@ -0,0 +1,47 @@
+/*
+ * VFD_HLD812D_Profile.cpp
+ * 
+ * Tube profile data for HL-D812D VFD display
+ * 
+ * 자리별 소수점/콜론 애넌시에이터가 없으므로 '.'/':'는 가운데 점 패턴으로 자리를 차지함
+ * (G5 앞 콜론은 P10을 같은 그리드의 세로 세그먼트와 공유하여 단독으로 켤 수 없음,
+ *  vfd-configs/connection-tables/HLD812D.md 참조)
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "VFD_HLD812D_Profile.h"
+#include "VFD_HLD812D_Map.h"
+#include "VFD_HLD812D_Font.h"
+#include "MAX6921_Transport.h"
+#include "MAX6921_TextLayout.h"
+
+static_assert(VFD_HLD812D_FONT_FIRST_CHAR == MAX6921_TUBE_FONT_FIRST && VFD_HLD812D_FONT_DENSE_SIZE == MAX6921_TUBE_FONT_SIZE,
+              "font table layout differs from profile font layout");
+static_assert(VFD_HLD812D_MAP_SEGMENTS <= MAX6921_FONT_MAX_SEGMENTS, "segments do not fit the packed font pattern");
+static_assert(VFD_HLD812D_MAP_FRAME_BYTES == MAX6921_CHAIN_BYTES(VFD_HLD812D_MAP_CHIPS), "output map frame size mismatch");
+
+static const char VFD_HLD812D_PROFILE_NAME[] PROGMEM = "HLD812D";
+
+const MAX6921_TubeProfile VFD_HLD812D_PROFILE PROGMEM = {
+    VFD_HLD812D_PROFILE_NAME,
+    VFD_HLD812D_MAP_GRIDS,
+    VFD_HLD812D_MAP_SEGMENTS,
+    VFD_HLD812D_MAP_CHIPS,
+    VFD_HLD812D_MAP_FRAME_BYTES,
+    255,                                  // 최대 밝기 레벨
+    &VFD_HLD812D_GRID_FRAME[0][0],
+    VFD_HLD812D_SEGMENT_FRAME_BYTE,
+    VFD_HLD812D_SEGMENT_FRAME_MASK,
+    VFD_HLD812D_GRID_CHAIN_BIT,
+    VFD_HLD812D_SEGMENT_CHAIN_BIT,
+    VFD_HLD812D_FONT_DENSE,
+    VFD_HLD812D_FONT_DIGITS,
+    VFD_NO_SEGMENT,                       // 소수점 없음
+    VFD_NO_SEGMENT,                       // 콜론 없음
+    0,
+    0,
+    3                                     // 시:분 콜론 자리 (애넌시에이터가 없으므로 표시 안 됨)
+};
@@ -0,0 +1,22 @@
+/*
+ * VFD_HLD812D_Profile.h
+ * 
+ * Tube profile for HL-D812D VFD display
+ * 연결 테이블 출력 맵, 폰트를 MAX6921_TubeProfile 하나로 묶음 (PROGMEM)
+ * 
+ *   vfd.begin(&VFD_HLD812D_PROFILE);   // 드라이버 용량 VFD_MAX_GRIDS >= 8 필요
+ * 
+ * Author: Generated from VFD Config Files
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef VFD_HLD812D_PROFILE_H
+#define VFD_HLD812D_PROFILE_H
+
+#include <Arduino.h>
+#include "MAX6921_TubeProfile.h"
+
+extern const MAX6921_TubeProfile VFD_HLD812D_PROFILE;
+
+#endif // VFD_HLD812D_PROFILE_H
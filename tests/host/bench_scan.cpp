@@ -0,0 +1,117 @@
+/*
+ * bench_scan.cpp
+ *
+ * 단계별 스캔 비용 벤치마크 (MAX6921_PROFILE 빌드, CSV 출력)
+ * 합성 프로필 4/7/8/12/16그리드 x SPI 클록 1/2/4/5MHz마다 하드웨어 SPI 전송 경로로
+ * 폴링 스캔하면서 매 화면 문자열을 바꿔(폰트 조회 + 인코딩) 단계별 누적 시간을 기록
+ *
+ *   bench_scan [출력.csv]      (인자가 없으면 표준 출력)
+ *
+ * CSV: grids,spi_hz,stage,count,total_ns,avg_ns,max_ns
+ * 측정 시계는 shim의 hostProfileClockNs() (호스트 CPU 실측 + SPI 선로 시간)이므로
+ * font_lookup/encode는 호스트 CPU 기준, transfer는 설정 클록 기준 값. 버전 간 회귀 비교용.
+ * 결과가 말이 되는지(단계마다 측정됨, 전송 ≥ 선로 시간, 화면 = 그리드 x 화면 수)만 검사
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define FRAMES      200
+#define SLOT_US     DEFAULT_GRID_SCAN_DELAY_US
+
+static const uint8_t gridCounts[] = { 4, 7, 8, 12, 16 };
+static const uint32_t spiClocks[] = { 1000000UL, 2000000UL, 4000000UL, 5000000UL };
+
+// 합성 출력 맵 (그리드 g = 체인 비트 g, 세그먼트는 7BT317NK 맵 그대로)
+static uint8_t gridFrame[16][VFD_MAP_FRAME_BYTES];
+static uint8_t gridChainBit[16];
+
+static void buildSyntheticProfile(MAX6921_TubeProfile* tube, uint8_t grids) {
+    memcpy_P(tube, &VFD_7BT317NK_PROFILE, sizeof(*tube));
+    for (uint8_t g = 0; g < 16; g++) {
+        memset(gridFrame[g], 0, sizeof(gridFrame[g]));
+        max6921SetChainBit(gridFrame[g], VFD_MAP_FRAME_BYTES, g);
+        gridChainBit[g] = g;
+    }
+    tube->numGrids = grids;
+    tube->gridFrame = &gridFrame[0][0];
+    tube->gridChainBit = gridChainBit;
+    tube->dpGrids = 0;
+    tube->colonGrids = 0;
+}
+
+static void runCase(FILE* out, uint8_t grids, uint32_t clockHz) {
+    MAX6921_TubeProfile tube;
+    buildSyntheticProfile(&tube, grids);
+
+    hostResetTime();
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin(&tube, clockHz));
+    vfd.setGridScanDelay(SLOT_US);
+    vfd.displayString("0");
+    hostRunPolling(vfd, (uint32_t)SLOT_US * grids * 2);     // 첫 화면 (플립 대기 화면 소비)
+    vfd.resetProfile();
+
+    // 화면마다 문자열 갱신 (폰트 조회 경로, 바뀐 자리만 인코딩)
+    char text[VFD_MAX_GRIDS + 1];
+    uint32_t start = vfd.getScanFrameCount();
+    long value = 0;
+    while (vfd.getScanFrameCount() - start < FRAMES) {
+        uint32_t frames = vfd.getScanFrameCount();
+        snprintf(text, sizeof(text), "%*ld", grids, value += 7);
+        vfd.displayString(text);
+        while (vfd.getScanFrameCount() == frames) {
+            vfd.refresh();
+            hostAdvance(1);
+        }
+    }
+
+    MAX6921_ProfileCounter counters[MAX6921_STAGE_COUNT];
+    for (uint8_t stage = 0; stage < MAX6921_STAGE_COUNT; stage++) {
+        counters[stage] = vfd.getProfile(stage);
+        const MAX6921_ProfileCounter& c = counters[stage];
+        fprintf(out, "%u,%lu,%s,%lu,%lu,%lu,%lu\n", grids, (unsigned long)clockHz,
+                MAX6921_VFD_Driver::getProfileStageName(stage), (unsigned long)c.count,
+                (unsigned long)c.total, (unsigned long)(c.count ? c.total / c.count : 0), (unsigned long)c.max);
+    }
+
+    // 결과 검사
+    uint32_t wireNs = (uint32_t)(8000000000ULL * vfd.getFrameBytes() / clockHz);
+    const MAX6921_ProfileCounter& transfer = counters[MAX6921_STAGE_TRANSFER];
+    const MAX6921_ProfileCounter& grid = counters[MAX6921_STAGE_GRID];
+    const MAX6921_ProfileCounter& frame = counters[MAX6921_STAGE_FRAME];
+    for (uint8_t stage = 0; stage < MAX6921_STAGE_COUNT; stage++) {
+        HOST_CHECK(counters[stage].count > 0);
+    }
+    HOST_CHECK_NEAR(grid.count, (uint32_t)FRAMES * grids, grids);
+    HOST_CHECK_EQ(transfer.count, grid.count);
+    HOST_CHECK_NEAR(frame.count, FRAMES, 1);
+    HOST_CHECK(transfer.total / transfer.count >= wireNs - 1000);    // 선로 시간 (1us 단위 진행)
+    HOST_CHECK(grid.total >= transfer.total);
+}
+
+int main(int argc, char** argv) {
+    FILE* out = stdout;
+    if (argc > 1) {
+        out = fopen(argv[1], "w");
+        if (out == NULL) {
+            perror(argv[1]);
+            return 2;
+        }
+    }
+
+    fprintf(out, "grids,spi_hz,stage,count,total_ns,avg_ns,max_ns\n");
+    for (uint8_t g = 0; g < sizeof(gridCounts); g++) {
+        for (uint8_t c = 0; c < sizeof(spiClocks) / sizeof(spiClocks[0]); c++) {
+            runCase(out, gridCounts[g], spiClocks[c]);
+        }
+    }
+
+    if (out != stdout) fclose(out);
+    return hostTestResult();
+}
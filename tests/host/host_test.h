@@ -0,0 +1,85 @@
+/*
+ * host_test.h
+ *
+ * 호스트 테스트 공통: 검사 매크로 + 시뮬레이터 시계 연결
+ *
+ *   MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+ *   hostAttachSim(sim);          // micros() = sim.getTimeUs(), hostAdvance() → sim.advance()
+ *   ...
+ *   HOST_CHECK(glass.getOverlapTime() == 0);
+ *   return hostTestResult();     // 실패가 있으면 1 (ctest 실패)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "MAX6921_Simulator.h"
+
+static int hostFailures = 0;
+static int hostChecks = 0;
+
+#define HOST_CHECK(cond) do { \
+    hostChecks++; \
+    if (!(cond)) { \
+        hostFailures++; \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while (0)
+
+#define HOST_CHECK_EQ(actual, expected) do { \
+    hostChecks++; \
+    long long _a = (long long)(actual); \
+    long long _e = (long long)(expected); \
+    if (_a != _e) { \
+        hostFailures++; \
+        printf("FAIL %s:%d: %s = %lld (expected %lld)\n", __FILE__, __LINE__, #actual, _a, _e); \
+    } \
+} while (0)
+
+// |actual - expected| <= tolerance
+#define HOST_CHECK_NEAR(actual, expected, tolerance) do { \
+    hostChecks++; \
+    double _a = (double)(actual); \
+    double _e = (double)(expected); \
+    if (_a < _e - (tolerance) || _a > _e + (tolerance)) { \
+        hostFailures++; \
+        printf("FAIL %s:%d: %s = %g (expected %g +/- %g)\n", __FILE__, __LINE__, #actual, _a, _e, (double)(tolerance)); \
+    } \
+} while (0)
+
+inline int hostTestResult() {
+    printf("%d checks, %d failures\n", hostChecks, hostFailures);
+    return (hostFailures == 0) ? 0 : 1;
+}
+
+// ===== 시뮬레이터 시계 =====
+
+inline uint32_t hostSimNow(void* context) {
+    return static_cast<MAX6921_SimTransport*>(context)->getTimeUs();
+}
+
+inline void hostSimAdvance(void* context, uint32_t us) {
+    static_cast<MAX6921_SimTransport*>(context)->advance(us);
+}
+
+// micros()가 sim.getTimeUs()를 반환하고 hostAdvance()/delay()가 시뮬레이션 시간을 진행
+inline void hostAttachSim(MAX6921_SimTransport& sim) {
+    hostAttachClock(hostSimNow, hostSimAdvance, &sim);
+}
+
+// 폴링 모드 주 루프: every us마다 refresh() 호출하며 us만큼 진행
+template<typename Driver>
+inline void hostRunPolling(Driver& vfd, uint32_t us, uint32_t every = 1) {
+    for (uint32_t t = 0; t < us; t += every) {
+        vfd.refresh();
+        hostAdvance(every);
+    }
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,589 @@
+/*
+ * Arduino.cpp (호스트 빌드용 shim)
+ *
+ * Implementation file for the host Arduino core shim
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <chrono>
+
+HardwareSerial Serial;
+SPIClass SPI;
+HostStatusRegister hostSREG;
+
+// ===========================================
+// 시계
+// ===========================================
+
+static uint32_t hostTimeUs = 0;
+static HostNowFunc hostNow = NULL;
+static HostAdvanceFunc hostStep = NULL;
+static void* hostClockContext = NULL;
+
+void hostAttachClock(HostNowFunc now, HostAdvanceFunc advance, void* context) {
+    hostNow = now;
+    hostStep = advance;
+    hostClockContext = context;
+}
+
+void hostDetachClock() {
+    hostAttachClock(NULL, NULL, NULL);
+}
+
+void hostResetTime() {
+    hostTimeUs = 0;
+}
+
+static void hostTimer1Step();
+static void hostSpiStep();
+static void hostDispatchInterrupts();
+
+void hostAdvance(uint32_t us) {
+    while (us-- > 0) {
+        if (hostStep != NULL) {
+            hostStep(hostClockContext, 1);
+        } else {
+            hostTimeUs++;
+        }
+        hostTimer1Step();
+        hostSpiStep();
+        hostDispatchInterrupts();
+    }
+}
+
+unsigned long micros() {
+    if (hostNow != NULL) return hostNow(hostClockContext);
+    return hostTimeUs;
+}
+
+unsigned long millis() {
+    return micros() / 1000UL;
+}
+
+void delay(unsigned long ms) {
+    hostAdvance(ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us) {
+    hostAdvance(us);
+}
+
+// ===========================================
+// 인터럽트
+// ===========================================
+
+static bool hostIrqEnabled = true;
+static bool hostInIsr = false;
+static uint32_t hostIrqDisableCount = 0;
+static uint32_t hostIsrEnableCount = 0;
+
+void noInterrupts() {
+    hostIrqEnabled = false;
+    hostIrqDisableCount++;
+}
+
+void interrupts() {
+    if (hostInIsr) hostIsrEnableCount++;
+    hostIrqEnabled = true;
+    hostDispatchInterrupts();             // 막혀 있던 동안 선 플래그 처리
+}
+
+bool hostInterruptsEnabled() {
+    return hostIrqEnabled;
+}
+
+uint32_t hostGetInterruptDisableCount() {
+    return hostIrqDisableCount;
+}
+
+uint32_t hostGetIsrInterruptEnableCount() {
+    return hostIsrEnableCount;
+}
+
+// ===========================================
+// 핀
+// ===========================================
+
+static uint8_t hostPinLevel[HOST_NUM_PINS];
+static uint32_t hostPinWrites[HOST_NUM_PINS];
+static HostPinFunc hostPinListener = NULL;
+static void* hostPinContext = NULL;
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+static uint64_t hostCycles = 0;
+
+void hostDelayCycles(uint32_t cycles) {
+    hostCycles += cycles;
+}
+
+uint64_t hostGetCycleCount() {
+    return hostCycles;
+}
+
+uint32_t hostProfileClockNs() {
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    uint64_t cpuNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - origin).count();
+    return (uint32_t)(cpuNs + (uint64_t)micros() * 1000ULL);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= HOST_NUM_PINS) return;
+    hostCycles += HOST_PIN_WRITE_CYCLES;
+    hostPinLevel[pin] = value ? HIGH : LOW;
+    hostPinWrites[pin]++;
+    if (hostPinListener != NULL) hostPinListener(hostPinContext, pin, hostPinLevel[pin]);
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= HOST_NUM_PINS) return LOW;
+    return hostPinLevel[pin];
+}
+
+void hostAttachPinListener(HostPinFunc listener, void* context) {
+    hostPinListener = listener;
+    hostPinContext = context;
+}
+
+uint32_t hostGetPinWriteCount(uint8_t pin) {
+    return (pin < HOST_NUM_PINS) ? hostPinWrites[pin] : 0;
+}
+
+// ===========================================
+// Timer1
+// ===========================================
+
+volatile uint8_t TCCR1A;
+volatile uint8_t TCCR1B;
+volatile uint16_t TCNT1;
+volatile uint16_t ICR1;
+volatile uint16_t OCR1A;
+volatile uint16_t OCR1B;
+volatile uint8_t TIMSK1;
+HostFlagRegister TIFR1;
+
+// 드라이버가 정의하는 벡터 (타이머 스캔 코드가 없는 빌드에서는 NULL)
+extern "C" void hostTimer1OverflowVector(void) __attribute__((weak));
+extern "C" void hostTimer1CompareBVector(void) __attribute__((weak));
+
+static uint16_t hostOcr1aActive = 0;      // Fast PWM: OCR1x는 BOTTOM에서 적용
+static uint16_t hostOcr1bActive = 0;
+static uint32_t hostTickRemainder = 0;    // 1us 미만 카운트 누적 (F_CPU 단위)
+static HostIsrStats hostOverflowStats;
+static HostIsrStats hostCompareBStats;
+
+uint8_t digitalPinToTimer(uint8_t pin) {
+    if (pin == 9) return TIMER1A;
+    if (pin == 10) return TIMER1B;
+    return NOT_ON_TIMER;
+}
+
+static void hostSetOutputCompare(uint8_t pin, uint8_t level) {
+    if (hostPinLevel[pin] == level) return;
+    hostPinLevel[pin] = level;
+    if (hostPinListener != NULL) hostPinListener(hostPinContext, pin, level);
+}
+
+static uint16_t hostTimer1Prescaler() {
+    switch (TCCR1B & (_BV(CS12) | _BV(CS11) | _BV(CS10))) {
+        case 1: return 1;
+        case 2: return 8;
+        case 3: return 64;
+        case 4: return 256;
+        case 5: return 1024;
+        default: return 0;
+    }
+}
+
+static void hostTimer1Tick() {
+    bool fastPwmIcr = (TCCR1B & (_BV(WGM13) | _BV(WGM12))) == (_BV(WGM13) | _BV(WGM12)) &&
+                      (TCCR1A & (_BV(WGM11) | _BV(WGM10))) == _BV(WGM11);
+    uint16_t top = fastPwmIcr ? ICR1 : 0xFFFF;
+
+    // 실제 하드웨어처럼 TOP과 같을 때만 되돌아감 (TOP을 카운터 아래로 내리면 0xFFFF까지 셈)
+    if (TCNT1 == top || TCNT1 == 0xFFFF) {
+        TCNT1 = 0;
+        TIFR1.set(_BV(TOV1));
+        if (fastPwmIcr) {
+            hostOcr1aActive = OCR1A;
+            hostOcr1bActive = OCR1B;
+            if (TCCR1A & _BV(COM1A1)) hostSetOutputCompare(9, HIGH);
+            if (TCCR1A & _BV(COM1B1)) hostSetOutputCompare(10, HIGH);
+        }
+    } else {
+        TCNT1 = TCNT1 + 1;
+    }
+
+    uint16_t compareA = fastPwmIcr ? hostOcr1aActive : OCR1A;
+    uint16_t compareB = fastPwmIcr ? hostOcr1bActive : OCR1B;
+    if (TCNT1 == compareA) {
+        TIFR1.set(_BV(OCF1A));
+        if (TCCR1A & _BV(COM1A1)) hostSetOutputCompare(9, LOW);
+    }
+    if (TCNT1 == compareB) {
+        TIFR1.set(_BV(OCF1B));
+        if (TCCR1A & _BV(COM1B1)) hostSetOutputCompare(10, LOW);
+    }
+}
+
+static void hostTimer1Step() {
+    uint16_t prescaler = hostTimer1Prescaler();
+    if (prescaler == 0) return;
+
+    hostTickRemainder += F_CPU / 1000000UL;
+    while (hostTickRemainder >= prescaler) {
+        hostTickRemainder -= prescaler;
+        hostTimer1Tick();
+    }
+}
+
+static void hostRunVector(void (*vector)(void), HostIsrStats& stats) {
+    uint32_t entry = micros();
+    if (stats.count > 0) {
+        uint32_t interval = entry - stats.lastEntryUs;
+        if (stats.count == 1 || interval < stats.minIntervalUs) stats.minIntervalUs = interval;
+        if (interval > stats.maxIntervalUs) stats.maxIntervalUs = interval;
+    }
+    stats.count++;
+    stats.lastEntryUs = entry;
+
+    // 하드웨어와 같이 ISR 안에서는 인터럽트 꺼짐
+    hostInIsr = true;
+    hostIrqEnabled = false;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (vector != NULL) vector();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    hostIrqEnabled = true;
+    hostInIsr = false;
+
+    uint32_t duration = micros() - entry;
+    if (duration > stats.maxDurationUs) stats.maxDurationUs = duration;
+    uint32_t hostNs = (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    if (hostNs > stats.maxHostNs) stats.maxHostNs = hostNs;
+}
+
+static void hostDispatchSpi();
+
+static void hostDispatchInterrupts() {
+    if (!hostIrqEnabled || hostInIsr) return;
+
+    // 벡터 번호가 낮은 COMPB가 OVF보다 먼저
+    if ((TIFR1 & _BV(OCF1B)) && (TIMSK1 & _BV(OCIE1B))) {
+        TIFR1 = _BV(OCF1B);
+        hostRunVector(hostTimer1CompareBVector, hostCompareBStats);
+    }
+    if ((TIFR1 & _BV(TOV1)) && (TIMSK1 & _BV(TOIE1))) {
+        TIFR1 = _BV(TOV1);
+        hostRunVector(hostTimer1OverflowVector, hostOverflowStats);
+    }
+    hostDispatchSpi();
+}
+
+void hostResetTimer1() {
+    TCCR1A = 0;
+    TCCR1B = 0;
+    TCNT1 = 0;
+    ICR1 = 0;
+    OCR1A = 0;
+    OCR1B = 0;
+    TIMSK1 = 0;
+    TIFR1 = 0xFF;
+    hostOcr1aActive = 0;
+    hostOcr1bActive = 0;
+    hostTickRemainder = 0;
+    hostResetIsrStats();
+}
+
+void hostResetIsrStats() {
+    memset(&hostOverflowStats, 0, sizeof(hostOverflowStats));
+    memset(&hostCompareBStats, 0, sizeof(hostCompareBStats));
+}
+
+const HostIsrStats& hostGetOverflowStats() {
+    return hostOverflowStats;
+}
+
+const HostIsrStats& hostGetCompareBStats() {
+    return hostCompareBStats;
+}
+
+// ===========================================
+// String / Print
+// ===========================================
+
+String::String(long value, int base) {
+    char buffer[40];
+    if (base == HEX) {
+        snprintf(buffer, sizeof(buffer), "%lX", value);
+    } else {
+        snprintf(buffer, sizeof(buffer), "%ld", value);
+    }
+    _s = buffer;
+}
+
+void String::trim() {
+    size_t first = _s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        _s.clear();
+        return;
+    }
+    size_t last = _s.find_last_not_of(" \t\r\n");
+    _s = _s.substr(first, last - first + 1);
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size-- > 0) n += write(*buffer++);
+    return n;
+}
+
+size_t Print::print(const char* text) {
+    return write(text);
+}
+
+size_t Print::print(const __FlashStringHelper* text) {
+    return write((const char*)text);
+}
+
+size_t Print::print(const String& text) {
+    return write(text.c_str());
+}
+
+size_t Print::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t Print::print(long value, int base) {
+    if (base == DEC) {
+        char buffer[24];
+        snprintf(buffer, sizeof(buffer), "%ld", value);
+        return write(buffer);
+    }
+    return print((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+    char buffer[72];
+    if (base == HEX) {
+        snprintf(buffer, sizeof(buffer), "%lX", value);
+    } else if (base == BIN) {
+        int n = 0;
+        char bits[72];
+        do {
+            bits[n++] = (char)('0' + (value & 1));
+            value >>= 1;
+        } while (value != 0);
+        for (int i = 0; i < n; i++) buffer[i] = bits[n - 1 - i];
+        buffer[n] = '\0';
+    } else {
+        snprintf(buffer, sizeof(buffer), "%lu", value);
+    }
+    return write(buffer);
+}
+
+size_t Print::print(double value, int digits) {
+    char buffer[40];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return write(buffer);
+}
+
+size_t Print::println() {
+    return write("\r\n");
+}
+
+// ===========================================
+// Serial
+// ===========================================
+
+#define HOST_SERIAL_RX_SIZE 1024
+
+static uint8_t hostSerialRx[HOST_SERIAL_RX_SIZE];
+static size_t hostSerialHead = 0;
+static size_t hostSerialTail = 0;
+
+void hostSerialFeed(const uint8_t* data, size_t length) {
+    while (length-- > 0) {
+        size_t next = (hostSerialHead + 1) % HOST_SERIAL_RX_SIZE;
+        if (next == hostSerialTail) return;
+        hostSerialRx[hostSerialHead] = *data++;
+        hostSerialHead = next;
+    }
+}
+
+size_t HardwareSerial::write(uint8_t byte) {
+    if (byte != '\r') fputc(byte, stdout);
+    return 1;
+}
+
+int HardwareSerial::available() {
+    return (int)((hostSerialHead + HOST_SERIAL_RX_SIZE - hostSerialTail) % HOST_SERIAL_RX_SIZE);
+}
+
+int HardwareSerial::read() {
+    if (hostSerialHead == hostSerialTail) return -1;
+    uint8_t byte = hostSerialRx[hostSerialTail];
+    hostSerialTail = (hostSerialTail + 1) % HOST_SERIAL_RX_SIZE;
+    return byte;
+}
+
+int HardwareSerial::peek() {
+    if (hostSerialHead == hostSerialTail) return -1;
+    return hostSerialRx[hostSerialTail];
+}
+
+String HardwareSerial::readString() {
+    String text;
+    int c;
+    while ((c = read()) >= 0) text += (char)c;
+    return text;
+}
+
+// ===========================================
+// SPI
+// ===========================================
+
+SPIClass::SPIClass()
+    : _inTransaction(false), _logLength(0), _byteCount(0), _transactionCount(0),
+      _listener(NULL), _listenerContext(NULL), _pendingNs(0) {
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+    _settings = settings;
+    _inTransaction = true;
+    _transactionCount++;
+}
+
+void SPIClass::endTransaction() {
+    _inTransaction = false;
+}
+
+void SPIClass::hostRecordByte(uint8_t data) {
+    if (_logLength < HOST_SPI_LOG_SIZE) _log[_logLength++] = data;
+    _byteCount++;
+    if (_listener != NULL) _listener(_listenerContext, data);
+}
+
+// 8클록만큼 시간 진행 (동기 전송 비용이 ISR/루프 시간에 그대로 나타남)
+uint8_t SPIClass::transfer(uint8_t data) {
+    hostRecordByte(data);
+
+    if (_settings.clock > 0) {
+        _pendingNs += 8000000000ULL / _settings.clock;
+        if (_pendingNs >= 1000) {
+            uint32_t us = (uint32_t)(_pendingNs / 1000);
+            _pendingNs -= (uint64_t)us * 1000;
+            hostAdvance(us);
+        }
+    }
+    return 0;
+}
+
+void SPIClass::clearLog() {
+    _logLength = 0;
+    _byteCount = 0;
+    _transactionCount = 0;
+}
+
+void SPIClass::attachListener(HostSpiFunc listener, void* context) {
+    _listener = listener;
+    _listenerContext = context;
+}
+
+// ===========================================
+// SPI 레지스터 모델
+// ===========================================
+
+volatile uint8_t SPCR = 0;
+HostSpsrRegister SPSR;
+HostSpdrRegister SPDR;
+
+// 드라이버가 정의하는 벡터 (비동기 SPI 코드가 없는 빌드에서는 NULL)
+extern "C" void hostSpiTransferCompleteVector(void) __attribute__((weak));
+
+static uint8_t hostSpsr = 0;
+static bool hostSpsrSeen = false;         // SPIF가 선 SPSR을 읽었음 (다음 SPDR 접근에서 SPIF 지움)
+static bool hostSpiBusy = false;
+static uint8_t hostSpiShiftData = 0;
+static uint32_t hostSpiRemainingNs = 0;
+static uint32_t hostSpiCollisions = 0;
+static HostIsrStats hostSpiStats;
+
+static void hostSpiAccessData() {
+    if (hostSpsrSeen) hostSpsr &= (uint8_t)~(_BV(SPIF) | _BV(WCOL));
+    hostSpsrSeen = false;
+}
+
+HostSpsrRegister::operator uint8_t() const {
+    if (hostSpiBusy && !(hostSpsr & _BV(SPIF))) hostAdvance(1);
+    if (hostSpsr & _BV(SPIF)) hostSpsrSeen = true;
+    return hostSpsr;
+}
+
+HostSpdrRegister& HostSpdrRegister::operator=(uint8_t data) {
+    hostSpiAccessData();
+    if (hostSpiBusy) {
+        hostSpsr |= _BV(WCOL);
+        hostSpiCollisions++;
+        return *this;
+    }
+    uint32_t clock = SPI.getSettings().clock;
+    hostSpiShiftData = data;
+    hostSpiRemainingNs = (clock > 0) ? (uint32_t)(8000000000ULL / clock) : 0;
+    hostSpiBusy = true;
+    return *this;
+}
+
+HostSpdrRegister::operator uint8_t() const {
+    hostSpiAccessData();
+    return 0;
+}
+
+// 1us 진행: 8클록이 끝나면 바이트를 내보내고 SPIF
+static void hostSpiStep() {
+    if (!hostSpiBusy) return;
+    hostSpiRemainingNs = (hostSpiRemainingNs > 1000) ? hostSpiRemainingNs - 1000 : 0;
+    if (hostSpiRemainingNs > 0) return;
+
+    hostSpiBusy = false;
+    SPI.hostRecordByte(hostSpiShiftData);
+    hostSpsr |= _BV(SPIF);
+}
+
+static void hostDispatchSpi() {
+    if ((hostSpsr & _BV(SPIF)) && (SPCR & _BV(SPIE))) {
+        hostSpsr &= (uint8_t)~_BV(SPIF);
+        hostSpsrSeen = false;
+        hostRunVector(hostSpiTransferCompleteVector, hostSpiStats);
+    }
+}
+
+void hostResetSpiRegisters() {
+    SPCR = 0;
+    hostSpsr = 0;
+    hostSpsrSeen = false;
+    hostSpiBusy = false;
+    hostSpiRemainingNs = 0;
+    hostSpiCollisions = 0;
+    memset(&hostSpiStats, 0, sizeof(hostSpiStats));
+}
+
+uint32_t hostGetSpiCollisionCount() {
+    return hostSpiCollisions;
+}
+
+bool hostSpiShifting() {
+    return hostSpiBusy;
+}
+
+const HostIsrStats& hostGetSpiStats() {
+    return hostSpiStats;
+}
@@ -0,0 +1,269 @@
+/*
+ * Arduino.h (호스트 빌드용 shim)
+ *
+ * MAX6921_VFD_Driver를 Linux에서 컴파일하기 위한 최소 Arduino 코어.
+ * 라이브러리가 쓰는 API만 제공한다 (PROGMEM은 일반 메모리, 핀은 배열).
+ *
+ * ===== 시계 =====
+ *
+ * micros()/millis()는 호스트 시계를 읽는다. 시간은 hostAdvance()로만 흐르며
+ * delay()/delayMicroseconds()도 hostAdvance()를 호출한다.
+ * hostAttachClock()으로 시뮬레이터를 연결하면 micros()가 sim.getTimeUs()를 반환하고
+ * hostAdvance()가 sim.advance()를 호출한다 (host_test.h의 hostAttachSim() 참조).
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH            1
+#define LOW             0
+#define INPUT           0
+#define OUTPUT          1
+#define INPUT_PULLUP    2
+#define LSBFIRST        0
+#define MSBFIRST        1
+#define DEC             10
+#define HEX             16
+#define BIN             2
+
+#define HOST_NUM_PINS   64
+
+// PROGMEM: 호스트에서는 일반 메모리
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define pgm_read_byte(p)        (*(const uint8_t*)(p))
+#define pgm_read_word(p)        (*(const uint16_t*)(p))
+#define pgm_read_dword(p)       (*(const uint32_t*)(p))
+#define pgm_read_ptr(p)         (*(void* const*)(p))
+#define memcpy_P                memcpy
+#define strlen_P                strlen
+#define strcmp_P                strcmp
+#define strncmp_P               strncmp
+
+class __FlashStringHelper;
+#define F(s)                    ((const __FlashStringHelper*)(s))
+
+#define _BV(bit)                (1U << (bit))
+
+// ===== 시계 =====
+typedef uint32_t (*HostNowFunc)(void* context);
+typedef void (*HostAdvanceFunc)(void* context, uint32_t us);
+
+// 외부 시계 연결 (NULL이면 내부 카운터)
+void hostAttachClock(HostNowFunc now, HostAdvanceFunc advance, void* context);
+void hostDetachClock();
+
+// 시간 진행 (1us 단위로 진행하며 시뮬레이터 시간과 함께 움직임)
+void hostAdvance(uint32_t us);
+void hostResetTime();
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// ===== 인터럽트 =====
+void noInterrupts();
+void interrupts();
+bool hostInterruptsEnabled();
+uint32_t hostGetInterruptDisableCount();     // noInterrupts() 호출 수 (임계 구역 진입 횟수)
+uint32_t hostGetIsrInterruptEnableCount();   // ISR 실행 중 interrupts() 호출 수 (하드웨어라면 ISR 중첩 허용)
+
+// SREG: I 비트(7)만 모델 (읽으면 현재 인터럽트 상태, 쓰면 그 상태로 복원)
+class HostStatusRegister {
+public:
+    operator uint8_t() const { return hostInterruptsEnabled() ? 0x80 : 0x00; }
+    HostStatusRegister& operator=(uint8_t value) {
+        if (value & 0x80) interrupts(); else noInterrupts();
+        return *this;
+    }
+};
+extern HostStatusRegister hostSREG;
+#define SREG    hostSREG                  // AVR io 헤더와 같이 매크로 (라이브러리는 defined(SREG)로 확인)
+
+inline void cli() { noInterrupts(); }
+inline void sei() { interrupts(); }
+
+// ===== 핀 =====
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// 핀 변화 통지 (전송 계층의 LOAD/BLANK 확인용, NULL이면 없음)
+typedef void (*HostPinFunc)(void* context, uint8_t pin, uint8_t value);
+void hostAttachPinListener(HostPinFunc listener, void* context);
+uint32_t hostGetPinWriteCount(uint8_t pin);
+
+// ===== 사이클 시계 (GPIO 비트뱅 타이밍 확인용) =====
+//
+// micros()와 별개로 F_CPU 사이클만 센다. digitalWrite()는 포트 명령(sbi/cbi)과 같은
+// HOST_PIN_WRITE_CYCLES로 계산하고 (실제 digitalWrite()보다 짧은 최악 조건), 핀 변화 통지는
+// 그 명령이 끝난 시점에 보낸다. 라이브러리의 max6921DelayNs()는 MAX6921_DELAY_CYCLES로 지연을 더한다.
+#define HOST_PIN_WRITE_CYCLES   2
+#define MAX6921_DELAY_CYCLES(cycles)    hostDelayCycles(cycles)
+
+void hostDelayCycles(uint32_t cycles);
+uint64_t hostGetCycleCount();
+
+// ===== 단계별 측정 시계 (MAX6921_PROFILE 빌드) =====
+// 호스트 CPU 실측 ns + 시뮬레이션 시간(SPI 전송, delayMicroseconds 등 hostAdvance() x 1000)
+// 폰트 조회/인코딩은 호스트 CPU 시간, SPI 시프트는 설정한 클록의 선로 시간으로 나타남
+#define MAX6921_PROFILE_CLOCK()     hostProfileClockNs()
+uint32_t hostProfileClockNs();
+
+inline void yield() {}
+
+// ===== Timer1 (ATmega328P 16비트 타이머 모델) =====
+//
+// hostAdvance()가 1us마다 F_CPU / 프리스케일러 만큼 카운트하고, 플래그가 서 있고 인터럽트가
+// 켜져 있으면 벡터를 호출한다 (ISR 안에서는 인터럽트 꺼짐, 중첩 없음, COMPB가 OVF보다 우선).
+// Fast PWM 모드 14 (TOP = ICR1): BOTTOM에서 TOV1 + OCR1A/B 버퍼 갱신, 비교 일치에서 OCF1B.
+// COM1A1/COM1B1이 켜져 있으면 OC1A(D9)/OC1B(D10)를 BOTTOM에서 HIGH, 비교 일치에서 LOW로 구동
+// (digitalWrite와 같이 핀 변화 통지).
+#ifndef F_CPU
+#define F_CPU           16000000UL
+#endif
+
+#define ISR(vector)     extern "C" void vector(void)
+#define TIMER1_OVF_vect     hostTimer1OverflowVector
+#define TIMER1_COMPB_vect   hostTimer1CompareBVector
+
+// 1을 쓰면 해당 플래그가 지워지는 인터럽트 플래그 레지스터
+class HostFlagRegister {
+private:
+    volatile uint8_t _value;
+public:
+    HostFlagRegister() : _value(0) {}
+    HostFlagRegister& operator=(uint8_t clearBits) { _value &= (uint8_t)~clearBits; return *this; }
+    operator uint8_t() const { return _value; }
+    void set(uint8_t bits) { _value |= bits; }
+};
+
+extern volatile uint8_t TCCR1A;
+extern volatile uint8_t TCCR1B;
+extern volatile uint16_t TCNT1;
+extern volatile uint16_t ICR1;
+extern volatile uint16_t OCR1A;
+extern volatile uint16_t OCR1B;
+extern volatile uint8_t TIMSK1;
+extern HostFlagRegister TIFR1;
+
+// TCCR1A
+#define WGM10           0
+#define WGM11           1
+#define COM1B0          4
+#define COM1B1          5
+#define COM1A0          6
+#define COM1A1          7
+// TCCR1B
+#define CS10            0
+#define CS11            1
+#define CS12            2
+#define WGM12           3
+#define WGM13           4
+// TIMSK1 / TIFR1
+#define TOIE1           0
+#define OCIE1A          1
+#define OCIE1B          2
+#define TOV1            0
+#define OCF1A           1
+#define OCF1B           2
+
+#define NOT_ON_TIMER    0
+#define TIMER1A         3
+#define TIMER1B         4
+uint8_t digitalPinToTimer(uint8_t pin);   // Uno: D9 = OC1A, D10 = OC1B
+
+// 벡터별 호출 통계 (시작 간격과 소요 시간은 시뮬레이션 us)
+struct HostIsrStats {
+    uint32_t count;
+    uint32_t lastEntryUs;
+    uint32_t minIntervalUs;               // 연속 호출 시작 간격
+    uint32_t maxIntervalUs;
+    uint32_t maxDurationUs;               // 1회 최대 소요 시간 (ISR 안의 delayMicroseconds, SPI 전송 포함)
+    uint32_t maxHostNs;                   // 1회 최대 소요 시간 (호스트 CPU 실측)
+};
+
+void hostResetTimer1();                   // 레지스터 + 통계 초기화
+void hostResetIsrStats();
+const HostIsrStats& hostGetOverflowStats();
+const HostIsrStats& hostGetCompareBStats();
+
+// ===== 문자열 / 출력 =====
+class String {
+private:
+    std::string _s;
+public:
+    String(const char* text = "") : _s(text ? text : "") {}
+    String(long value, int base = DEC);
+    String& operator+=(const char* text) { _s += text; return *this; }
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    bool operator==(const char* text) const { return _s == text; }
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    void trim();
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t byte) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+    size_t print(const char* text);
+    size_t print(const __FlashStringHelper* text);
+    size_t print(const String& text);
+    size_t print(char c);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template<typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template<typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+// Serial: 출력은 stdout, 입력은 hostSerialFeed()로 넣은 바이트
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    operator bool() const { return true; }
+    virtual size_t write(uint8_t byte);
+    using Print::write;
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    String readString();
+};
+
+extern HardwareSerial Serial;
+void hostSerialFeed(const uint8_t* data, size_t length);
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,123 @@
+/*
+ * SPI.h (호스트 빌드용 shim)
+ *
+ * 전송한 바이트를 기록하는 SPI 버스.
+ * 보낸 바이트를 getLog()에 순서대로 남기므로
+ * 하드웨어 SPI 전송 계층의 비트열을 그대로 확인할 수 있다.
+ * attachListener()로 바이트마다 통지받을 수도 있다 (예: 가상 체인에 클록).
+ * transfer()는 설정된 SPI 클록으로 8비트를 보내는 시간만큼 hostAdvance()를 호출한다.
+ *
+ * ATmega328P SPI 레지스터 모델 (SPCR/SPSR/SPDR, SPI_STC_vect): 인터럽트 연쇄 전송용
+ * - SPDR에 쓰면 현재 SPI 클록(beginTransaction)으로 8비트 시프트를 시작하고 바로 반환
+ * - hostAdvance()가 1us씩 진행하다 8클록이 끝나면 바이트를 기록/통지(transfer()와 같음)하고 SPIF를 세움
+ * - SPIF는 SPIF가 선 SPSR을 읽은 뒤 SPDR에 접근하거나 벡터가 실행되면 지워짐
+ * - SPIE가 켜져 있고 인터럽트가 켜져 있으면 SPI_STC_vect 호출 (Timer1 벡터 다음 순서)
+ * - 시프트 중 SPDR에 쓰면 무시하고 WCOL (충돌 수는 hostGetSpiCollisionCount())
+ * - 시프트 중 SPSR을 읽으면 1us 진행 (SPIF 폴링 대기가 끝나도록)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0       0x00
+#define SPI_MODE1       0x04
+#define SPI_MODE2       0x08
+#define SPI_MODE3       0x0C
+
+#define HOST_SPI_LOG_SIZE   256
+
+class SPISettings {
+public:
+    SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+    SPISettings(uint32_t clockHz, uint8_t order, uint8_t mode)
+        : clock(clockHz), bitOrder(order), dataMode(mode) {}
+
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+typedef void (*HostSpiFunc)(void* context, uint8_t byte);
+
+class SPIClass {
+private:
+    SPISettings _settings;
+    bool _inTransaction;
+    uint8_t _log[HOST_SPI_LOG_SIZE];
+    uint16_t _logLength;
+    uint32_t _byteCount;
+    uint32_t _transactionCount;
+    HostSpiFunc _listener;
+    void* _listenerContext;
+    uint64_t _pendingNs;                  // 1us 미만 전송 시간 누적
+
+public:
+    SPIClass();
+
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+
+    // 기록 (가득 차면 뒤쪽 바이트는 버리고 개수만 셈)
+    void clearLog();
+    const uint8_t* getLog() const { return _log; }
+    uint16_t getLogLength() const { return _logLength; }
+    uint32_t getByteCount() const { return _byteCount; }
+    uint32_t getTransactionCount() const { return _transactionCount; }
+    bool inTransaction() const { return _inTransaction; }
+    const SPISettings& getSettings() const { return _settings; }
+
+    void attachListener(HostSpiFunc listener, void* context);
+
+    // 바이트 1개가 버스에 나감 (기록 + 통지, 레지스터 모델도 사용)
+    void hostRecordByte(uint8_t data);
+};
+
+extern SPIClass SPI;
+
+// ===== SPI 레지스터 모델 =====
+#define SPI_STC_vect    hostSpiTransferCompleteVector
+
+// SPCR
+#define SPR0            0
+#define SPR1            1
+#define CPHA            2
+#define CPOL            3
+#define MSTR            4
+#define DORD            5
+#define SPE             6
+#define SPIE            7
+// SPSR
+#define SPI2X           0
+#define WCOL            6
+#define SPIF            7
+
+class HostSpsrRegister {
+public:
+    operator uint8_t() const;             // 읽기: SPIF 확인 기록, 시프트 중이면 1us 진행
+};
+
+class HostSpdrRegister {
+public:
+    HostSpdrRegister& operator=(uint8_t data);  // 쓰기: 시프트 시작
+    operator uint8_t() const;             // 읽기: 수신 바이트 (MISO 없음 = 0)
+};
+
+extern volatile uint8_t SPCR;
+extern HostSpsrRegister SPSR;
+extern HostSpdrRegister SPDR;
+
+void hostResetSpiRegisters();
+uint32_t hostGetSpiCollisionCount();
+bool hostSpiShifting();
+const HostIsrStats& hostGetSpiStats();
+
+#endif // HOST_SPI_H
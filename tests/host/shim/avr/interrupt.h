@@ -0,0 +1,16 @@
+/*
+ * avr/interrupt.h (호스트 빌드용 shim)
+ *
+ * ISR(), cli(), sei()는 Arduino.h shim에 있음
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#include <Arduino.h>
+
+#endif // HOST_AVR_INTERRUPT_H
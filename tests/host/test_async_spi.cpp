@@ -0,0 +1,202 @@
+/*
+ * test_async_spi.cpp
+ *
+ * 인터럽트 연쇄 SPI 전송 (MAX6921_AsyncSPITransport, shim의 SPCR/SPSR/SPDR + SPI_STC_vect 모델)
+ * - 칩 2/4개 체인 프레임 (5/10바이트, 1/4MHz): send()는 첫 바이트만 시작하고 반환
+ * - LOAD는 마지막 바이트의 8클록이 끝난 뒤에만 상승, 완료 콜백은 LOAD 상승 뒤 1번
+ * - 바이트마다 ISR 1번, 전송 시간 = 바이트 수 x 8클록, 가상 체인 래치 = 프레임
+ * - 전송 중 send(): waitIdle()이 이전 프레임을 끝까지 보내고 래치한 뒤 시작 (SPDR 충돌 없음)
+ *   인터럽트가 꺼진 상태(다른 ISR 안)에서도 SPIF 폴링으로 진행하고 인터럽트 상태를 그대로 둠
+ * - send() 뒤 원본 버퍼를 바꿔도 보낸 프레임은 그대로 (복사본 전송)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_Transport.h"
+#include "MAX6921_Simulator.h"
+#include "host_test.h"
+
+#define LOAD_PIN        10
+#define MAX_EVENTS      256
+#define TIMEOUT_US      1000
+
+enum EventType { EV_LOAD_LOW, EV_BYTE, EV_LOAD_HIGH, EV_COMPLETE };
+
+struct Event {
+    EventType type;
+    uint32_t timeUs;
+};
+
+struct Bench {
+    MAX6921_SimChain* chain;
+    Event events[MAX_EVENTS];
+    uint16_t count;
+};
+
+static Bench bench;
+
+static void record(EventType type) {
+    if (bench.count < MAX_EVENTS) {
+        bench.events[bench.count].type = type;
+        bench.events[bench.count].timeUs = micros();
+        bench.count++;
+    }
+}
+
+static void onByte(void* context, uint8_t byte) {
+    (void)context;
+    for (int8_t bit = 7; bit >= 0; bit--) bench.chain->clock((byte >> bit) & 1);
+    record(EV_BYTE);
+}
+
+static void onPin(void* context, uint8_t pin, uint8_t value) {
+    (void)context;
+    if (pin != LOAD_PIN) return;
+    bench.chain->setLoad(value == HIGH);
+    record(value == HIGH ? EV_LOAD_HIGH : EV_LOAD_LOW);
+}
+
+static void onComplete(void* context) {
+    (void)context;
+    record(EV_COMPLETE);
+}
+
+static void makeFrame(uint8_t* frame, uint8_t length, uint8_t seed) {
+    for (uint8_t i = 0; i < length; i++) frame[i] = (uint8_t)(seed * 37 + i * 101 + 1);
+}
+
+// 가상 체인 래치 = 프레임을 그대로 클록한 기준 체인
+static bool latchMatches(const uint8_t* frame, uint8_t length, uint8_t chips) {
+    MAX6921_SimChain reference(chips);
+    for (uint8_t i = 0; i < length; i++) {
+        for (int8_t bit = 7; bit >= 0; bit--) reference.clock((frame[i] >> bit) & 1);
+    }
+    reference.setLoad(true);
+    for (uint8_t bit = 0; bit < reference.getNumBits(); bit++) {
+        if (bench.chain->getLatch(bit) != reference.getLatch(bit)) return false;
+    }
+    return true;
+}
+
+// 이벤트 순서 검사: 프레임마다 LOAD LOW → 바이트 length개 → LOAD HIGH → 완료
+// 반환: 검사한 프레임 수 (순서가 어긋나면 0)
+static uint8_t checkSequence(uint8_t length) {
+    uint16_t i = 0;
+    uint8_t frames = 0;
+    while (i < bench.count) {
+        if (bench.events[i++].type != EV_LOAD_LOW) return 0;
+        for (uint8_t b = 0; b < length; b++) {
+            if (i >= bench.count || bench.events[i++].type != EV_BYTE) return 0;
+        }
+        uint32_t lastByte = bench.events[i - 1].timeUs;
+        if (i >= bench.count || bench.events[i].type != EV_LOAD_HIGH) return 0;
+        if (bench.events[i++].timeUs < lastByte) return 0;
+        if (i >= bench.count || bench.events[i++].type != EV_COMPLETE) return 0;
+        frames++;
+    }
+    return frames;
+}
+
+static void waitDone(MAX6921_AsyncSPITransport& spi) {
+    for (uint32_t t = 0; t < TIMEOUT_US && spi.isBusy(); t++) hostAdvance(1);
+}
+
+static void runFrame(uint8_t chips, uint32_t clockHz) {
+    uint8_t length = MAX6921_CHAIN_BYTES(chips);
+    MAX6921_SimChain chain(chips);
+    bench.chain = &chain;
+    bench.count = 0;
+    hostResetSpiRegisters();
+
+    MAX6921_AsyncSPITransport spi(LOAD_PIN, clockHz);
+    spi.setTransferCallback(onComplete, NULL);
+    spi.begin();
+    bench.count = 0;
+
+    uint8_t frame[MAX6921_ASYNC_MAX_BYTES];
+    uint8_t sent[MAX6921_ASYNC_MAX_BYTES];
+    makeFrame(frame, length, chips);
+    memcpy(sent, frame, length);
+
+    uint32_t start = micros();
+    spi.send(frame, length);
+    memset(frame, 0, sizeof(frame));              // 복사본을 보내므로 영향 없음
+
+    // 반환 직후: LOAD LOW, 첫 바이트 시프트 중
+    HOST_CHECK(spi.isBusy());
+    HOST_CHECK_EQ(digitalRead(LOAD_PIN), LOW);
+    HOST_CHECK(hostSpiShifting());
+    HOST_CHECK_EQ(bench.count, 1);
+
+    waitDone(spi);
+    uint32_t elapsed = micros() - start;
+    uint32_t byteUs = (uint32_t)((8000000ULL + clockHz - 1) / clockHz);
+
+    printf("%u chips (%u bytes) @ %lu Hz: %u us, %u ISRs, LOAD rise %u us after last byte\n",
+           chips, length, (unsigned long)clockHz, (unsigned)elapsed, (unsigned)hostGetSpiStats().count,
+           (unsigned)(bench.events[bench.count - 2].timeUs - bench.events[bench.count - 3].timeUs));
+
+    HOST_CHECK(!spi.isBusy());
+    HOST_CHECK_EQ(digitalRead(LOAD_PIN), HIGH);
+    HOST_CHECK_EQ(checkSequence(length), 1);
+    HOST_CHECK_EQ(hostGetSpiStats().count, length);
+    HOST_CHECK_EQ(elapsed, length * byteUs);
+    HOST_CHECK(latchMatches(sent, length, chips));
+    HOST_CHECK_EQ(chain.getShortLatchCount(), 0);
+    HOST_CHECK_EQ(chain.getTransparentClockCount(), 0);
+    HOST_CHECK_EQ(hostGetSpiCollisionCount(), 0);
+}
+
+// 전송 중 send(): 이전 프레임을 끝까지 보내고 래치한 뒤 시작
+static void runBackToBack(bool interruptsOff) {
+    const uint8_t chips = 4;
+    uint8_t length = MAX6921_CHAIN_BYTES(chips);
+    MAX6921_SimChain chain(chips);
+    bench.chain = &chain;
+    hostResetSpiRegisters();
+
+    MAX6921_AsyncSPITransport spi(LOAD_PIN, 4000000);
+    spi.setTransferCallback(onComplete, NULL);
+    spi.begin();
+    bench.count = 0;
+
+    uint8_t frames[3][MAX6921_ASYNC_MAX_BYTES];
+    for (uint8_t f = 0; f < 3; f++) makeFrame(frames[f], length, (uint8_t)(f + 10));
+
+    if (interruptsOff) noInterrupts();            // 스캔 ISR 안에서 보내는 경우
+    spi.send(frames[0], length);
+    spi.send(frames[1], length);
+    HOST_CHECK(latchMatches(frames[0], length, chips));
+    spi.send(frames[2], length);
+    HOST_CHECK(latchMatches(frames[1], length, chips));
+    HOST_CHECK_EQ(hostInterruptsEnabled(), !interruptsOff);
+    if (interruptsOff) interrupts();
+
+    waitDone(spi);
+    HOST_CHECK(!spi.isBusy());
+    HOST_CHECK_EQ(checkSequence(length), 3);
+    HOST_CHECK(latchMatches(frames[2], length, chips));
+    HOST_CHECK_EQ(chain.getShortLatchCount(), 0);
+    HOST_CHECK_EQ(hostGetSpiCollisionCount(), 0);
+    printf("back-to-back (interrupts %s): 3 frames latched in order, %u SPDR collisions\n",
+           interruptsOff ? "off" : "on", (unsigned)hostGetSpiCollisionCount());
+}
+
+int main() {
+    hostAttachPinListener(onPin, NULL);
+    SPI.attachListener(onByte, NULL);
+
+    runFrame(2, 4000000);
+    runFrame(4, 4000000);
+    runFrame(2, 1000000);
+    runFrame(4, 1000000);
+    runBackToBack(false);
+    runBackToBack(true);
+
+    SPI.attachListener(NULL, NULL);
+    hostAttachPinListener(NULL, NULL);
+    return hostTestResult();
+}
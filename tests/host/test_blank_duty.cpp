@@ -0,0 +1,122 @@
+/*
+ * test_blank_duty.cpp
+ *
+ * 공통 BLANK 밝기 제어 (가상 체인 + 유리, "8888888", 2000us 슬롯)
+ * - 그리드별 표시 시간 = (슬롯 - BLANK 예약) x max6921BrightnessToDuty() (밝기 0-255)
+ * - 감마 2.0: 표시 비율의 제곱근이 밝기에 선형, 밝기가 오르면 표시 시간도 단조 증가
+ * - 그리드별 드웰 보정, 비블로킹 fadeTo()
+ * - 모든 밝기에서 그리드 겹침 0, 짧은 래치 0, 시프트 중 BLANK 해제 0 (동기/4MHz 비동기 전송)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <math.h>
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define RUN_FRAMES      10
+#define SLOT_US         DEFAULT_GRID_SCAN_DELAY_US
+#define FRAME_US        ((uint32_t)SLOT_US * VFD_NUM_GRIDS)
+#define USABLE_US       (SLOT_US - DEFAULT_BLANK_GUARD_US)
+#define TRIM_GRID       3
+#define MIN_LINEAR_US   10
+
+static uint32_t expectedOnTime(uint8_t brightness) {
+    uint32_t perSlot = ((uint32_t)USABLE_US * max6921BrightnessToDuty(brightness, VFD_MAX_BRIGHTNESS)) >> 16;
+    return perSlot * RUN_FRAMES;
+}
+
+// 밝기 하나를 RUN_FRAMES 화면 동안 표시하고 그리드 0의 표시 시간 반환
+static uint32_t runBrightness(uint8_t brightness, uint32_t clockHz) {
+    VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS, VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+    if (clockHz != 0) sim.setClockSpeed(clockHz);
+    hostAttachSim(sim);
+
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.setBrightness(brightness);
+    vfd.displayString("8888888");
+
+    hostRunPolling(vfd, FRAME_US);
+    glass.reset();
+    hostRunPolling(vfd, FRAME_US * RUN_FRAMES);
+
+    uint32_t expected = expectedOnTime(brightness);
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        HOST_CHECK_NEAR(glass.getGridOnTime(grid), expected, RUN_FRAMES * 2);
+    }
+    HOST_CHECK_EQ(glass.getOverlapTime(), 0);
+    HOST_CHECK_EQ(sim.getChain().getShortLatchCount(), 0);
+    HOST_CHECK_EQ(sim.getBlankReleaseDuringShiftCount(), 0);
+    return glass.getGridOnTime(0);
+}
+
+int main() {
+    // 밝기 0-255: 표시 시간과 감마 선형성
+    uint32_t fullOn = runBrightness(VFD_MAX_BRIGHTNESS, 0);
+    HOST_CHECK_NEAR(fullOn, (uint32_t)USABLE_US * RUN_FRAMES, RUN_FRAMES * 2);
+
+    uint32_t previous = 0;
+    double worstError = 0;
+    for (uint16_t b = 0; b <= VFD_MAX_BRIGHTNESS; b += 5) {
+        uint32_t on = runBrightness((uint8_t)b, 0);
+        HOST_CHECK(on >= previous);
+        previous = on;
+
+        // 슬롯당 1us 단위로 잘리므로 표시 시간이 짧은 낮은 밝기는 선형성 비교에서 제외
+        if (on < MIN_LINEAR_US * RUN_FRAMES) continue;
+        double perceived = sqrt((double)on / fullOn) * VFD_MAX_BRIGHTNESS;
+        double error = fabs(perceived - b);
+        if (error > worstError) worstError = error;
+    }
+    printf("gamma 2.0 (>= %u us/slot): worst |sqrt(duty) x 255 - brightness| = %.2f\n", MIN_LINEAR_US, worstError);
+    HOST_CHECK(worstError < 1.0);
+    HOST_CHECK_EQ(runBrightness(0, 0), 0);
+
+    // 4MHz 비동기 전송: 전송이 끝나기 전에는 BLANK를 해제하지 않음
+    runBrightness(VFD_MAX_BRIGHTNESS, 4000000);
+    runBrightness(128, 4000000);
+    runBrightness(16, 4000000);
+
+    // 드웰 보정: 보정한 그리드만 비율로 줄어듦
+    VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS, VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("8888888");
+    vfd.setGridDwellTrim(TRIM_GRID, 128);
+
+    hostRunPolling(vfd, FRAME_US);
+    glass.reset();
+    hostRunPolling(vfd, FRAME_US * RUN_FRAMES);
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        uint32_t expected = (uint32_t)USABLE_US * RUN_FRAMES;
+        if (grid == TRIM_GRID) expected = expected * 128 / 255;
+        HOST_CHECK_NEAR(glass.getGridOnTime(grid), expected, RUN_FRAMES * 2);
+    }
+    vfd.setGridDwellTrim(TRIM_GRID, 255);
+
+    // 페이드: refresh()만으로 진행, 끝나면 목표 밝기
+    vfd.fadeTo(0, 100);
+    HOST_CHECK(vfd.isFading());
+    hostRunPolling(vfd, 50000UL);
+    HOST_CHECK(vfd.isFading());
+    HOST_CHECK(vfd.getBrightness() > 0 && vfd.getBrightness() < VFD_MAX_BRIGHTNESS);
+    hostRunPolling(vfd, 70000UL);
+    HOST_CHECK(!vfd.isFading());
+    HOST_CHECK_EQ(vfd.getBrightness(), 0);
+
+    glass.reset();
+    hostRunPolling(vfd, FRAME_US * RUN_FRAMES);
+    HOST_CHECK_EQ(glass.getGridOnTime(0), 0);
+    HOST_CHECK_EQ(glass.getOverlapTime(), 0);
+
+    hostDetachClock();
+    return hostTestResult();
+}
@@ -0,0 +1,196 @@
+/*
+ * test_chain_stream.cpp
+ *
+ * 칩 1-4개 체인 프레임 비트 동일성 (max6921PackChain, MAX6921_SPITransport)
+ * - 프레임 = 기준 비트열 (앞쪽 0 패딩 + 칩 #N 워드 ... 칩 #1 워드, 각 MSB 먼저)
+ *   바이트 수 = MAX6921_CHAIN_BYTES(N) (3, 5, 8, 10바이트)
+ * - SPI 전송: 트랜잭션 1번에 프레임 바이트 그대로
+ * - SPI 비트열을 가상 체인에 클록 → 칩별 래치 = 워드, max6921SetChainBit(k) → 체인 비트 k만
+ * - begin(): 프로필 칩 수(1-4개) 체인 전체를 0으로 래치 (프레임 바이트 수만큼 클록)
+ * - SPI 클록 상한 = 5MHz (데이터시트 tCP 200ns)
+ * (칩 4개 프로필을 담는 VFD_MAX_FRAME_BYTES=10 구성으로 빌드)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define PATTERNS    64
+#define WORD_MASK   ((1UL << MAX6921_OUTPUT_BITS) - 1)
+
+static uint32_t lcgState = 12345;
+
+static uint32_t nextWord() {
+    lcgState = lcgState * 1103515245UL + 12345UL;
+    return (lcgState >> 8) & WORD_MASK;
+}
+
+// 기준 비트열: 시프트 레지스터에 먼저 들어간 비트가 체인 끝으로 밀려나므로
+// 패딩 → 칩 #N → ... → 칩 #1 순서, 워드마다 OUT19부터
+static void referenceStream(const uint32_t* words, uint8_t numChips, uint8_t* out) {
+    uint8_t length = MAX6921_CHAIN_BYTES(numChips);
+    uint16_t padding = length * 8 - numChips * MAX6921_OUTPUT_BITS;
+    uint16_t position = 0;
+    memset(out, 0, length);
+
+    position += padding;
+    for (int8_t chip = numChips - 1; chip >= 0; chip--) {
+        for (int8_t bit = MAX6921_OUTPUT_BITS - 1; bit >= 0; bit--) {
+            if (words[chip] & (1UL << bit)) out[position >> 3] |= (uint8_t)(0x80 >> (position & 7));
+            position++;
+        }
+    }
+}
+
+// SPI 바이트 → 가상 체인 클록 (MSB 먼저, SPI_MODE0)
+static void clockIntoChain(void* context, uint8_t byte) {
+    MAX6921_SimChain* chain = static_cast<MAX6921_SimChain*>(context);
+    for (int8_t bit = 7; bit >= 0; bit--) chain->clock((byte >> bit) & 1);
+}
+
+static uint32_t latchedWord(const MAX6921_SimChain& chain, uint8_t chip) {
+    uint32_t word = 0;
+    for (uint8_t bit = 0; bit < MAX6921_OUTPUT_BITS; bit++) {
+        if (chain.getLatch(chip * MAX6921_OUTPUT_BITS + bit)) word |= 1UL << bit;
+    }
+    return word;
+}
+
+// 프레임을 SPI 전송 계층으로 보내고 기록/체인 래치 확인
+static void checkSend(MAX6921_SPITransport& transport, MAX6921_SimChain& chain,
+                      const uint8_t* frame, uint8_t length, const uint32_t* words, uint8_t numChips) {
+    SPI.clearLog();
+    uint32_t transactions = SPI.getTransactionCount();
+
+    chain.setLoad(false);
+    transport.send(frame, length);
+    chain.setLoad(true);
+
+    HOST_CHECK_EQ(SPI.getTransactionCount() - transactions, 1);
+    HOST_CHECK_EQ(SPI.getLogLength(), length);
+    HOST_CHECK(memcmp(SPI.getLog(), frame, length) == 0);
+    for (uint8_t chip = 0; chip < numChips; chip++) {
+        HOST_CHECK_EQ(latchedWord(chain, chip), words[chip]);
+    }
+}
+
+// 칩 N개 프로필 (그리드 g = 체인 비트 g, 세그먼트 맵은 7BT317NK 그대로)
+static uint8_t gridFrame[VFD_NUM_GRIDS][MAX6921_CHAIN_BYTES(MAX6921_SIM_MAX_CHIPS)];
+
+static void buildChainProfile(MAX6921_TubeProfile* tube, uint8_t numChips) {
+    memcpy_P(tube, &VFD_7BT317NK_PROFILE, sizeof(*tube));
+    tube->numChips = numChips;
+    tube->frameBytes = MAX6921_CHAIN_BYTES(numChips);
+    for (uint8_t g = 0; g < VFD_NUM_GRIDS; g++) {
+        memset(gridFrame[g], 0, sizeof(gridFrame[g]));
+        max6921SetChainBit(gridFrame[g], tube->frameBytes, g);
+    }
+    tube->gridFrame = &gridFrame[0][0];
+}
+
+// 전송 계층 begin() 직후 모든 출력을 켜 두는 가상 체인 (전원 투입 시 임의 출력)
+class PoweredUpTransport : public MAX6921_SimTransport {
+public:
+    PoweredUpTransport(uint8_t numChips) : MAX6921_SimTransport(numChips) {}
+
+    virtual void begin() {
+        MAX6921_SimTransport::begin();
+        uint8_t ones[MAX6921_CHAIN_BYTES(MAX6921_SIM_MAX_CHIPS)];
+        memset(ones, 0xFF, sizeof(ones));
+        send(ones, sizeof(ones));
+    }
+};
+
+// begin(): 프로필 칩 수만큼의 0 프레임으로 체인 전체를 끔
+static void checkBeginClearsChain(uint8_t numChips) {
+    MAX6921_TubeProfile tube;
+    buildChainProfile(&tube, numChips);
+
+    PoweredUpTransport sim(numChips);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin(&tube));
+
+    uint16_t lit = 0;
+    for (uint8_t bit = 0; bit < sim.getChain().getNumBits(); bit++) {
+        if (sim.getChain().getLatch(bit)) lit++;
+    }
+    HOST_CHECK_EQ(sim.getFrameCount(), 2);
+    HOST_CHECK_EQ(sim.getChain().getClockCount(), (MAX6921_CHAIN_BYTES(MAX6921_SIM_MAX_CHIPS) + MAX6921_CHAIN_BYTES(numChips)) * 8);
+    HOST_CHECK_EQ(lit, 0);
+}
+
+int main() {
+    static const uint8_t expectedBytes[MAX6921_SIM_MAX_CHIPS + 1] = { 0, 3, 5, 8, 10 };
+
+    MAX6921_SPITransport transport(10, DEFAULT_SPI_CLOCK_SPEED);
+    transport.begin();
+
+    for (uint8_t numChips = 1; numChips <= MAX6921_SIM_MAX_CHIPS; numChips++) {
+        uint8_t length = MAX6921_CHAIN_BYTES(numChips);
+        HOST_CHECK_EQ(length, expectedBytes[numChips]);
+
+        MAX6921_SimChain chain(numChips);
+        SPI.attachListener(clockIntoChain, &chain);
+
+        uint32_t words[MAX6921_SIM_MAX_CHIPS];
+        uint8_t frame[MAX6921_CHAIN_BYTES(MAX6921_SIM_MAX_CHIPS)];
+        uint8_t expected[MAX6921_CHAIN_BYTES(MAX6921_SIM_MAX_CHIPS)];
+
+        // 임의 워드 + 전부 0/1 + 칩마다 다른 고정 패턴
+        for (uint8_t p = 0; p < PATTERNS + 3; p++) {
+            for (uint8_t chip = 0; chip < numChips; chip++) {
+                if (p == PATTERNS) words[chip] = 0;
+                else if (p == PATTERNS + 1) words[chip] = WORD_MASK;
+                else if (p == PATTERNS + 2) words[chip] = (0x12345UL * (chip + 1)) & WORD_MASK;
+                else words[chip] = nextWord();
+            }
+
+            max6921PackChain(words, numChips, frame);
+            referenceStream(words, numChips, expected);
+            HOST_CHECK(memcmp(frame, expected, length) == 0);
+            checkSend(transport, chain, frame, length, words, numChips);
+        }
+
+        // 20비트 밖 비트는 잘림
+        for (uint8_t chip = 0; chip < numChips; chip++) words[chip] = 0xFFF00000UL;
+        max6921PackChain(words, numChips, frame);
+        for (uint8_t i = 0; i < length; i++) HOST_CHECK_EQ(frame[i], 0);
+
+        // 체인 비트 하나씩
+        for (uint8_t bit = 0; bit < numChips * MAX6921_OUTPUT_BITS; bit++) {
+            memset(frame, 0, length);
+            max6921SetChainBit(frame, length, bit);
+
+            memset(words, 0, sizeof(words));
+            words[bit / MAX6921_OUTPUT_BITS] = 1UL << (bit % MAX6921_OUTPUT_BITS);
+            checkSend(transport, chain, frame, length, words, numChips);
+        }
+
+        HOST_CHECK_EQ(chain.getShortLatchCount(), 0);
+        SPI.attachListener(NULL, NULL);
+    }
+
+    for (uint8_t numChips = 1; numChips <= MAX6921_SIM_MAX_CHIPS; numChips++) {
+        checkBeginClearsChain(numChips);
+    }
+
+    // SPI 클록 상한 (생성자/setClockSpeed 모두)
+    uint8_t ones[1] = { 0xFF };
+    HOST_CHECK_EQ(MAX6921_MAX_SPI_CLOCK, 5000000UL);
+    MAX6921_SPITransport fast(10, 8000000UL);
+    fast.begin();
+    fast.send(ones, 1);
+    HOST_CHECK_EQ(SPI.getSettings().clock, MAX6921_MAX_SPI_CLOCK);
+    fast.setClockSpeed(20000000UL);
+    fast.send(ones, 1);
+    HOST_CHECK_EQ(SPI.getSettings().clock, MAX6921_MAX_SPI_CLOCK);
+
+    printf("chain frames: 1-4 chips = %u/%u/%u/%u bytes (3 bytes per chip: 3/6/9/12)\n",
+           MAX6921_CHAIN_BYTES(1), MAX6921_CHAIN_BYTES(2), MAX6921_CHAIN_BYTES(3), MAX6921_CHAIN_BYTES(4));
+    return hostTestResult();
+}
@@ -0,0 +1,126 @@
+/*
+ * test_dirty_grids.cpp
+ *
+ * 바뀐 그리드만 다시 만들기 (시계/계기 작업 부하)
+ * - 시계: 하루(86400초) 동안 매초 displayString("HH:MM:SS")
+ * - 계기: displayNumber(0 → 99999)
+ * 갱신마다 다시 인코딩한 그리드 수 = 자리(문자 + 소수점/콜론)가 바뀐 그리드 수,
+ * 폰트 조회 수 = 문자가 바뀐 자리 수인지 확인하고, 매번 전체를 다시 만드는 방식(그리드 7개 + 조회 7번)과 비교
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define CLOCK_SECONDS   86400UL
+#define METER_COUNT     100000L
+
+struct Workload {
+    uint32_t updates;
+    uint32_t rebuilds;
+    uint32_t lookups;
+    uint32_t rebuildMismatches;
+    uint32_t lookupMismatches;
+};
+
+// 이전 자리 배치와 비교해 이번 갱신에서 바뀌어야 하는 그리드/문자 수
+static void countChanges(const MAX6921_TextCell* before, const MAX6921_TextCell* after,
+                         uint8_t* changedGrids, uint8_t* changedChars) {
+    *changedGrids = 0;
+    *changedChars = 0;
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        bool charChanged = before[grid].character != after[grid].character;
+        if (charChanged) (*changedChars)++;
+        if (charChanged || before[grid].marks != after[grid].marks) (*changedGrids)++;
+    }
+}
+
+static void record(Workload& work, MAX6921_VFD_Driver& vfd, uint32_t lookupsBefore,
+                   uint8_t changedGrids, uint8_t changedChars) {
+    uint32_t lookups = vfd.getFontLookupCount() - lookupsBefore;
+    work.updates++;
+    work.rebuilds += vfd.getLastRebuildCount();
+    work.lookups += lookups;
+    if (vfd.getLastRebuildCount() != changedGrids) work.rebuildMismatches++;
+    if (lookups != changedChars) work.lookupMismatches++;
+}
+
+static void report(const char* name, const Workload& work) {
+    uint32_t naive = work.updates * VFD_NUM_GRIDS;
+    printf("%-28s %6u updates: rebuilt %6u grids (%.2f/update), font lookups %6u, naive %u + %u (%.1fx less)\n",
+           name, (unsigned)work.updates, (unsigned)work.rebuilds, (double)work.rebuilds / work.updates,
+           (unsigned)work.lookups, (unsigned)naive, (unsigned)naive, (double)naive / work.rebuilds);
+    HOST_CHECK_EQ(work.rebuildMismatches, 0);
+    HOST_CHECK_EQ(work.lookupMismatches, 0);
+    HOST_CHECK(work.rebuilds * 3 < naive);
+}
+
+int main() {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+
+    // 시계: 매초 화면 문자열 전체를 다시 넘김
+    MAX6921_TextCell previous[VFD_NUM_GRIDS];
+    MAX6921_TextCell current[VFD_NUM_GRIDS];
+    max6921LayoutText("", previous, VFD_NUM_GRIDS, VFD_DP_GRIDS, VFD_COLON_GRIDS);
+    vfd.resetUpdateStats();
+
+    Workload clock;
+    memset(&clock, 0, sizeof(clock));
+    for (uint32_t second = 0; second < CLOCK_SECONDS; second++) {
+        char text[16];
+        snprintf(text, sizeof(text), "%02u:%02u:%02u",
+                 (unsigned)(second / 3600), (unsigned)(second / 60 % 60), (unsigned)(second % 60));
+        max6921LayoutText(text, current, VFD_NUM_GRIDS, VFD_DP_GRIDS, VFD_COLON_GRIDS);
+
+        uint8_t changedGrids, changedChars;
+        countChanges(previous, current, &changedGrids, &changedChars);
+        uint32_t lookups = vfd.getFontLookupCount();
+        vfd.displayString(text);
+        record(clock, vfd, lookups, changedGrids, changedChars);
+
+        memcpy(previous, current, sizeof(previous));
+        vfd.advanceScan();                // 스캔은 계속 진행 (플립 대기 화면 소비)
+    }
+    report("clock HH:MM:SS every 1 s", clock);
+    HOST_CHECK_EQ(vfd.getTotalRebuildCount(), clock.rebuilds);
+
+    // 같은 내용을 다시 그리면 아무 것도 하지 않음
+    uint32_t lookups = vfd.getFontLookupCount();
+    vfd.displayString("23:59:59");
+    HOST_CHECK_EQ(vfd.getLastRebuildCount(), 0);
+    HOST_CHECK_EQ(vfd.getFontLookupCount(), lookups);
+
+    // 계기: 오른쪽 정렬 숫자 (앞 공백 자리는 조회 없이 빈 패턴)
+    vfd.clear();
+    vfd.resetUpdateStats();
+    Workload meter;
+    memset(&meter, 0, sizeof(meter));
+    max6921LayoutText("", previous, VFD_NUM_GRIDS, VFD_DP_GRIDS, VFD_COLON_GRIDS);
+    for (long value = 0; value < METER_COUNT; value++) {
+        char text[VFD_NUM_GRIDS + 1];
+        snprintf(text, sizeof(text), "%*ld", VFD_NUM_GRIDS, value);
+        max6921LayoutText(text, current, VFD_NUM_GRIDS, VFD_DP_GRIDS, VFD_COLON_GRIDS);
+
+        uint8_t changedGrids, changedChars;
+        countChanges(previous, current, &changedGrids, &changedChars);
+        uint32_t before = vfd.getFontLookupCount();
+        vfd.displayNumber(value);
+        record(meter, vfd, before, changedGrids, changedChars);
+
+        memcpy(previous, current, sizeof(previous));
+        vfd.advanceScan();
+    }
+    report("meter displayNumber 0-99999", meter);
+
+    hostDetachClock();
+    return hostTestResult();
+}
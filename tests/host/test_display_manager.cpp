@@ -0,0 +1,235 @@
+/*
+ * test_display_manager.cpp
+ *
+ * 공유 버스 관리자 (MAX6921_DisplayManager, 디스플레이 1-8개, 4MHz, 2000us 틱, 1초)
+ * - 공통 DIN/CLK/BLANK + 디스플레이별 LOAD를 가상 체인으로 연결 (SPI 바이트는 모든 체인에 클록)
+ * - LOAD 펄스마다 해당 체인의 래치 = 그 디스플레이 문자열의 그리드, LOAD HIGH 동안 클록 없음
+ * - 디스플레이별 스캔 주파수 출력: 틱마다 전체를 스캔하면 디스플레이 수와 관계없이 같음
+ * - 틱당 SPI 트랜잭션 1회, BLANK 전환 2회 (드라이버를 따로 돌리면 트랜잭션이 디스플레이 수만큼)
+ * - 틱당 디스플레이 수를 제한하면 라운드 로빈으로 모두 같은 비율
+ * - BLANK 예약 = 디스플레이당 전송 시간(추정/측정) x 틱당 디스플레이 수 + 여유:
+ *   표시 구간(BLANK LOW) = getOnTimeUs(), 전송 + 가드 + 표시가 틱 주기 안에 들어감 (1MHz 8개 포함)
+ * - 관리자 refresh()가 디스플레이별 효과(마퀴)를 진행
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_DisplayManager.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define BLANK_PIN       9
+#define FIRST_LOAD_PIN  20
+#define RUN_US          1000000UL
+#define TICK_US         DEFAULT_GRID_SCAN_DELAY_US
+
+struct Bench {
+    uint8_t count;
+    MAX6921_VFD_Driver* displays[MAX6921_MANAGER_MAX_DISPLAYS];
+    MAX6921_SimChain* chains[MAX6921_MANAGER_MAX_DISPLAYS];
+    char texts[MAX6921_MANAGER_MAX_DISPLAYS][VFD_NUM_GRIDS + 1];
+    uint32_t latches[MAX6921_MANAGER_MAX_DISPLAYS];
+    uint32_t wrongLatches;
+    uint32_t blankEdges;
+    uint8_t blankLevel;
+    uint32_t shownAt;                     // BLANK 해제 시각
+    uint32_t minShown, maxShown;          // 표시 구간 길이 (us)
+};
+
+static uint32_t chainWord(const MAX6921_SimChain& chain, uint8_t chip) {
+    uint32_t word = 0;
+    for (uint8_t bit = 0; bit < MAX6921_OUTPUT_BITS; bit++) {
+        if (chain.getLatch(chip * MAX6921_OUTPUT_BITS + bit)) word |= 1UL << bit;
+    }
+    return word;
+}
+
+// 공통 DIN/CLK: 모든 체인에 같은 비트
+static void clockAll(void* context, uint8_t byte) {
+    Bench* bench = static_cast<Bench*>(context);
+    for (uint8_t d = 0; d < bench->count; d++) {
+        for (int8_t bit = 7; bit >= 0; bit--) bench->chains[d]->clock((byte >> bit) & 1);
+    }
+}
+
+// 공통 BLANK + 디스플레이별 LOAD (상승 에지에서 래치 내용 확인)
+static void onPin(void* context, uint8_t pin, uint8_t value) {
+    Bench* bench = static_cast<Bench*>(context);
+    if (pin == BLANK_PIN) {
+        if (value != bench->blankLevel) {
+            bench->blankEdges++;
+            if (value == LOW) {
+                bench->shownAt = micros();
+            } else {
+                uint32_t shown = micros() - bench->shownAt;
+                if (shown < bench->minShown) bench->minShown = shown;
+                if (shown > bench->maxShown) bench->maxShown = shown;
+            }
+        }
+        bench->blankLevel = value;
+        for (uint8_t d = 0; d < bench->count; d++) bench->chains[d]->setBlank(value == HIGH);
+        return;
+    }
+    if (pin < FIRST_LOAD_PIN || pin >= FIRST_LOAD_PIN + bench->count) return;
+
+    uint8_t d = pin - FIRST_LOAD_PIN;
+    bench->chains[d]->setLoad(value == HIGH);
+    if (value != HIGH) return;
+
+    uint32_t data1 = chainWord(*bench->chains[d], 0);
+    uint32_t data2 = chainWord(*bench->chains[d], 1);
+    uint32_t gridBits = data1 & ((1UL << VFD_NUM_GRIDS) - 1);
+    uint8_t grid = 0;
+    while (grid < VFD_NUM_GRIDS && gridBits != (1UL << grid)) grid++;
+
+    uint32_t segments = ((data1 >> 7) & 0x1FFF) | (data2 << 13);
+    if (grid >= VFD_NUM_GRIDS || segments != getCharacterPattern(bench->texts[d][grid])) {
+        bench->wrongLatches++;
+    }
+    bench->latches[d]++;
+}
+
+// count개 디스플레이를 RUN_US 동안 폴링 스캔하고 결과 출력 + 검사
+static void runManager(uint8_t count, uint8_t maxPerTick, uint32_t clockHz = DEFAULT_SPI_CLOCK_SPEED) {
+    Bench bench;
+    memset(&bench, 0, sizeof(bench));
+    bench.count = count;
+
+    hostResetTime();
+    MAX6921_DisplayManager manager(BLANK_PIN);
+    for (uint8_t d = 0; d < count; d++) {
+        bench.displays[d] = new MAX6921_VFD_Driver(FIRST_LOAD_PIN + d, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+        bench.chains[d] = new MAX6921_SimChain(VFD_REQUIRED_CHIPS);
+        for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+            bench.texts[d][grid] = (char)('0' + (d + grid) % 10);
+        }
+        bench.texts[d][VFD_NUM_GRIDS] = '\0';
+        bench.displays[d]->displayString(bench.texts[d]);
+        HOST_CHECK(manager.addDisplay(bench.displays[d]));
+    }
+    manager.setMaxDisplaysPerTick(maxPerTick);
+
+    SPI.attachListener(clockAll, &bench);
+    hostAttachPinListener(onPin, &bench);
+    manager.begin(clockHz);
+
+    // 첫 화면 (플립 대기 화면 소비) 뒤부터 측정
+    uint32_t warmUp = (uint32_t)TICK_US * VFD_NUM_GRIDS * count;
+    for (uint32_t t = 0; t < warmUp; t++) {
+        manager.refresh();
+        hostAdvance(1);
+    }
+    manager.resetStats();
+    memset(bench.latches, 0, sizeof(bench.latches));
+    bench.wrongLatches = 0;
+    bench.blankEdges = 0;
+    bench.minShown = 0xFFFFFFFFUL;
+    bench.maxShown = 0;
+    uint32_t transactions = SPI.getTransactionCount();
+
+    // SPI 전송도 시간을 진행하므로 경과 시간 기준으로 실행
+    uint32_t busyUs = 0;
+    uint32_t runStart = micros();
+    while (micros() - runStart < RUN_US) {
+        uint32_t start = micros();
+        manager.refresh();
+        busyUs += micros() - start;
+        hostAdvance(1);
+    }
+
+    uint32_t ticks = manager.getTickCount();
+    uint32_t minScans = 0xFFFFFFFFUL;
+    uint32_t maxScans = 0;
+    for (uint8_t d = 0; d < count; d++) {
+        uint32_t scans = manager.getScanCount(d);
+        if (scans < minScans) minScans = scans;
+        if (scans > maxScans) maxScans = scans;
+        HOST_CHECK_EQ(bench.latches[d], scans);
+        HOST_CHECK_EQ(bench.chains[d]->getTransparentClockCount(), 0);
+    }
+
+    uint8_t perTick = maxPerTick ? maxPerTick : count;
+    uint32_t reserve = (uint32_t)manager.getTransferTimeUs() * perTick + MAX6921_TRANSFER_MARGIN_US;
+    if (reserve < DEFAULT_BLANK_GUARD_US) reserve = DEFAULT_BLANK_GUARD_US;
+    uint32_t slot = reserve + DEFAULT_BLANK_LEAD_US + DEFAULT_BLANK_TRAIL_US + manager.getOnTimeUs();
+
+    printf("%u display(s), %u/tick @ %lu Hz: %5u grid scans/s per display (%.1f Hz frames), ticks %u, "
+           "SPI transactions %u (separate drivers %u), BLANK edges %u, bus busy %u us/s, "
+           "transfer %u us/display, shown %u-%u us (on time %u)\n",
+           count, perTick, (unsigned long)clockHz, (unsigned)minScans, (double)minScans / VFD_NUM_GRIDS,
+           (unsigned)ticks, (unsigned)(SPI.getTransactionCount() - transactions),
+           (unsigned)(ticks * perTick), (unsigned)bench.blankEdges, (unsigned)busyUs,
+           manager.getTransferTimeUs(), (unsigned)bench.minShown, (unsigned)bench.maxShown, manager.getOnTimeUs());
+
+    HOST_CHECK(manager.getTransferTimeUs() >= (uint16_t)(VFD_FRAME_BYTES * 8000000UL / clockHz));
+    HOST_CHECK(slot <= TICK_US);
+    HOST_CHECK_NEAR(bench.minShown, manager.getOnTimeUs(), 1);
+    HOST_CHECK_NEAR(bench.maxShown, manager.getOnTimeUs(), 1);
+
+    HOST_CHECK_NEAR(ticks, RUN_US / TICK_US, 1);
+    HOST_CHECK_EQ(SPI.getTransactionCount() - transactions, ticks);
+    HOST_CHECK_NEAR(bench.blankEdges, ticks * 2, 2);
+    HOST_CHECK_EQ(bench.wrongLatches, 0);
+    HOST_CHECK(maxScans - minScans <= 1);
+    if (maxPerTick == 0) {
+        HOST_CHECK_EQ(minScans, ticks);
+    } else {
+        HOST_CHECK_NEAR(minScans, ticks * maxPerTick / count, 1);
+    }
+
+    SPI.attachListener(NULL, NULL);
+    hostAttachPinListener(NULL, NULL);
+    for (uint8_t d = 0; d < count; d++) {
+        delete bench.displays[d];
+        delete bench.chains[d];
+    }
+}
+
+// 관리자 refresh()가 효과 진행 (드라이버 refresh()를 부르지 않아도 마퀴가 흐름)
+static void runEffects() {
+    hostResetTime();
+    MAX6921_DisplayManager manager(BLANK_PIN);
+    MAX6921_VFD_Driver a(FIRST_LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    MAX6921_VFD_Driver b(FIRST_LOAD_PIN + 1, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(manager.addDisplay(&a));
+    HOST_CHECK(manager.addDisplay(&b));
+    manager.begin();
+
+    int8_t id = a.effects().marquee("MANAGED ", 0, VFD_NUM_GRIDS, 100, true);
+    HOST_CHECK(id >= 0);
+    b.displayString("STATIC");
+
+    uint32_t rebuildsA = a.getTotalRebuildCount();
+    uint32_t rebuildsB = b.getTotalRebuildCount();
+    uint32_t start = micros();
+    while (micros() - start < RUN_US) {
+        manager.refresh();
+        hostAdvance(1);
+    }
+    uint32_t stepsA = a.getTotalRebuildCount() - rebuildsA;
+    printf("effects under manager: marquee rebuilt %u grids in 1 s\n", (unsigned)stepsA);
+    HOST_CHECK(stepsA >= RUN_US / 100000UL);
+    HOST_CHECK_EQ(b.getTotalRebuildCount(), rebuildsB);
+    HOST_CHECK(a.effects().isActive(id));
+}
+
+int main() {
+    for (uint8_t count = 1; count <= MAX6921_MANAGER_MAX_DISPLAYS; count++) {
+        runManager(count, 0);
+    }
+
+    // 라운드 로빈: 틱당 2개
+    runManager(5, 2);
+    runManager(MAX6921_MANAGER_MAX_DISPLAYS, 2);
+
+    // 느린 클록: 전송 구간(8 x 40us)이 고정 가드(50us)보다 긴 경우
+    runManager(MAX6921_MANAGER_MAX_DISPLAYS, 0, 1000000UL);
+    runManager(MAX6921_MANAGER_MAX_DISPLAYS, 2, 1000000UL);
+
+    runEffects();
+
+    return hostTestResult();
+}
@@ -0,0 +1,218 @@
+/*
+ * test_effects_scan.cpp
+ *
+ * 효과 실행 중 스캔 주기 (2000us 슬롯, 5초)
+ * 마퀴(0-2) + 깜박임(3-4) + 와이프 → 크로스페이드 대기열(5-6) + 전체 fadeTo()를 동시에 실행
+ * - 폴링 모드: 래치 간격이 항상 슬롯 주기 (효과가 delay()로 기다리면 shim 시간이 늘어 바로 드러남)
+ * - 타이머 모드: ISR 주기가 항상 슬롯 주기, loop()의 refresh()가 효과 진행
+ * - refresh() 1회의 폰트 조회는 자릿수 이내 (효과 수와 관계없는 고정 비용)
+ * - 효과가 실제로 진행됨 (와이프/크로스페이드 종료, 마퀴 단계마다 화면 갱신, 페이드 목표 도달)
+ * - autoPresent를 끈 동안 효과는 back 버퍼에만 그림 (사용자의 present() 전에는 화면을 넘기지 않음)
+ * - 크로스페이드는 레벨이 바뀔 때만 표시 시간 재계산 (update()마다가 아님)
+ * - NULL 문자열 효과는 -1
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define LOAD_PIN    10
+#define BLANK_PIN   9
+#define SLOT_US     DEFAULT_GRID_SCAN_DELAY_US
+#define RUN_MS      5000UL
+
+struct EffectIds {
+    int8_t marquee;
+    int8_t blink;
+    int8_t wipe;
+    int8_t crossfade;
+};
+
+static EffectIds startEffects(MAX6921_VFD_Driver& vfd) {
+    EffectIds ids;
+    vfd.displayString("0000000");
+    ids.marquee = vfd.effects().marquee("SCROLLING TEXT ", 0, 3, 150, true);
+    ids.blink = vfd.effects().blink(3, 2, 400);
+    ids.wipe = vfd.effects().wipe("AB", 5, 2, 300);
+    ids.crossfade = vfd.effects().crossfade("CD", 5, 2, 1000);
+    vfd.fadeTo(VFD_MAX_BRIGHTNESS / 4, 2000);
+
+    HOST_CHECK(ids.marquee >= 0 && ids.blink >= 0 && ids.wipe >= 0 && ids.crossfade >= 0);
+    return ids;
+}
+
+static void checkEffectsDone(MAX6921_VFD_Driver& vfd, const EffectIds& ids, uint32_t contentSteps) {
+    HOST_CHECK(!vfd.effects().isActive(ids.wipe));
+    HOST_CHECK(!vfd.effects().isActive(ids.crossfade));
+    HOST_CHECK(vfd.effects().isActive(ids.marquee));
+    HOST_CHECK(vfd.effects().isActive(ids.blink));
+    HOST_CHECK(contentSteps > RUN_MS / 150 / 2);
+    HOST_CHECK(!vfd.isFading());
+    HOST_CHECK_EQ(vfd.getBrightness(), VFD_MAX_BRIGHTNESS / 4);
+}
+
+// 폴링 모드: 래치 시각 간격
+static void runPolling() {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    EffectIds ids = startEffects(vfd);
+
+    uint32_t frames = sim.getFrameCount();
+    uint32_t lastLatch = 0;
+    uint32_t minInterval = 0xFFFFFFFFUL;
+    uint32_t maxInterval = 0;
+    uint32_t maxLookups = 0;
+    uint32_t contentSteps = 0;
+    uint32_t rebuilds = vfd.getTotalRebuildCount();
+
+    uint32_t start = micros();
+    while (micros() - start < RUN_MS * 1000UL) {
+        uint32_t lookups = vfd.getFontLookupCount();
+        vfd.refresh();
+        if (vfd.getFontLookupCount() - lookups > maxLookups) maxLookups = vfd.getFontLookupCount() - lookups;
+
+        if (sim.getFrameCount() != frames) {
+            uint32_t now = micros();
+            if (lastLatch != 0) {
+                uint32_t interval = now - lastLatch;
+                if (interval < minInterval) minInterval = interval;
+                if (interval > maxInterval) maxInterval = interval;
+            }
+            lastLatch = now;
+            frames = sim.getFrameCount();
+        }
+        if (vfd.getTotalRebuildCount() != rebuilds) {
+            rebuilds = vfd.getTotalRebuildCount();
+            contentSteps++;
+        }
+        hostAdvance(1);
+    }
+
+    printf("polling: latch interval %u-%u us, max font lookups per refresh %u, content updates %u\n",
+           (unsigned)minInterval, (unsigned)maxInterval, (unsigned)maxLookups, (unsigned)contentSteps);
+    HOST_CHECK_EQ(minInterval, SLOT_US);
+    HOST_CHECK_EQ(maxInterval, SLOT_US);
+    HOST_CHECK(maxLookups <= VFD_NUM_GRIDS);
+    checkEffectsDone(vfd, ids, contentSteps);
+
+    hostDetachClock();
+}
+
+// 타이머 모드: ISR 주기 (효과는 loop()의 refresh()에서)
+static void runTimer() {
+    hostResetTimer1();
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    EffectIds ids = startEffects(vfd);
+    HOST_CHECK(vfd.beginTimerScan(SLOT_US));
+    hostAdvance(SLOT_US * 2);
+    hostResetIsrStats();
+
+    uint32_t contentSteps = 0;
+    uint32_t rebuilds = vfd.getTotalRebuildCount();
+    uint32_t start = micros();
+    while (micros() - start < RUN_MS * 1000UL) {
+        vfd.refresh();
+        if (vfd.getTotalRebuildCount() != rebuilds) {
+            rebuilds = vfd.getTotalRebuildCount();
+            contentSteps++;
+        }
+        hostAdvance(1);
+    }
+
+    const HostIsrStats& ovf = hostGetOverflowStats();
+    printf("timer: isr interval %u-%u us over %u slots, content updates %u\n",
+           (unsigned)ovf.minIntervalUs, (unsigned)ovf.maxIntervalUs, (unsigned)ovf.count, (unsigned)contentSteps);
+    HOST_CHECK_NEAR(ovf.count, RUN_MS * 1000UL / SLOT_US, 2);
+    HOST_CHECK_EQ(ovf.minIntervalUs, SLOT_US);
+    HOST_CHECK_EQ(ovf.maxIntervalUs, SLOT_US);
+    checkEffectsDone(vfd, ids, contentSteps);
+
+    vfd.endTimerScan();
+}
+
+// 화면 1회 스캔 (플립 대기 화면 소비)
+static void scanFrame(MAX6921_VFD_Driver& vfd) {
+    for (uint8_t slot = 0; slot < VFD_NUM_GRIDS; slot++) vfd.advanceScan();
+}
+
+// autoPresent 꺼짐: 효과 단계가 그리던 중인 back 버퍼를 넘기지 않음
+static void runManualPresent() {
+    hostResetTime();
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.setAutoPresent(false);
+    vfd.displayString("1234567");
+    vfd.present();
+    scanFrame(vfd);
+    HOST_CHECK(!vfd.isFlipPending());
+
+    vfd.displayCharacter(6, 'X');                 // 그리던 중 (아직 present() 전)
+    int8_t id = vfd.effects().marquee("ABC", 0, 3, 100, true);
+    HOST_CHECK(id >= 0);
+    uint32_t steps = 0;
+    for (uint32_t ms = 0; ms < 1000; ms++) {
+        uint32_t rebuilds = vfd.getTotalRebuildCount();
+        vfd.effects().update();
+        if (vfd.getTotalRebuildCount() != rebuilds) steps++;
+        HOST_CHECK(!vfd.isFlipPending());
+        hostAdvance(1000);
+    }
+    HOST_CHECK_EQ(steps, 0);                      // 인코딩도 사용자의 present()에서
+
+    vfd.present();
+    HOST_CHECK(vfd.isFlipPending());
+    vfd.effects().stop(id);
+    HOST_CHECK(vfd.effects().isIdle());
+}
+
+// 크로스페이드: 레벨이 바뀐 update()에서만 표시 시간 재계산 (ATOMIC 구간 = 그리드 수)
+static void runCrossfadeTiming() {
+    const uint16_t durationMs = 1000;
+    hostResetTime();
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("0000000");
+    int8_t id = vfd.effects().crossfade("CD", 5, 2, durationMs);
+    HOST_CHECK(id >= 0);
+
+    uint32_t updates = 0;
+    uint32_t disables = hostGetInterruptDisableCount();
+    while (vfd.effects().isActive(id)) {
+        vfd.effects().update();
+        updates++;
+        hostAdvance(100);
+    }
+    disables = hostGetInterruptDisableCount() - disables;
+
+    // 레벨 단계 (FADE_STEP_MS마다 1번) + 문자열 교체/종료 present()
+    uint32_t limit = (durationMs / MAX6921_EFFECT_FADE_STEP_MS + 4) * (VFD_NUM_GRIDS + 1);
+    printf("crossfade: %u updates, %u critical sections (limit %u)\n",
+           (unsigned)updates, (unsigned)disables, (unsigned)limit);
+    HOST_CHECK(updates > 5000);
+    HOST_CHECK(disables <= limit);
+}
+
+static void runNullText() {
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    HOST_CHECK_EQ(vfd.effects().marquee(NULL, 0, 3, 100), -1);
+    HOST_CHECK_EQ(vfd.effects().wipe(NULL, 0, 3, 100), -1);
+    HOST_CHECK_EQ(vfd.effects().crossfade(NULL, 0, 3, 100), -1);
+    HOST_CHECK(vfd.effects().isIdle());
+}
+
+int main() {
+    runPolling();
+    runTimer();
+    runManualPresent();
+    runCrossfadeTiming();
+    runNullText();
+    return hostTestResult();
+}
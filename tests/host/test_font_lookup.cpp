@@ -0,0 +1,98 @@
+/*
+ * test_font_lookup.cpp
+ *
+ * 폰트 조회: ASCII 직접 조회 테이블 vs 이전 선형 탐색
+ * - 이전 방식(문자 + 패턴 44개 표, 소문자는 대문자로 바꿔 순서대로 비교)을 직접 조회 테이블에서 다시 만들고
+ *   모든 문자 코드(0-255)에서 getCharacterPattern()/isCharacterSupported() 결과가 같은지 확인
+ * - 한 줄(7자리) 전체를 다시 쓰는 조회 시간 비교 (호스트)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <chrono>
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define LINES       200000UL
+
+// 이전 폰트 표 형식
+struct LegacyFontChar {
+    char character;
+    uint32_t pattern;
+};
+
+static LegacyFontChar legacyTable[VFD_FONT_DENSE_SIZE];
+static uint8_t legacySize = 0;
+
+// 직접 조회 테이블에서 이전 표 복원 (대문자/숫자/기호만, 소문자는 조회 시 대문자로 변환)
+static void buildLegacyTable() {
+    for (uint16_t c = VFD_FONT_FIRST_CHAR; c < VFD_FONT_FIRST_CHAR + VFD_FONT_DENSE_SIZE; c++) {
+        if (c >= 'a' && c <= 'z') continue;
+        if (!isCharacterSupported((char)c)) continue;
+        legacyTable[legacySize].character = (char)c;
+        legacyTable[legacySize].pattern = getCharacterPattern((char)c);
+        legacySize++;
+    }
+}
+
+static uint32_t legacyCharacterPattern(char ch) {
+    if (ch >= 'a' && ch <= 'z') {
+        ch = ch - 'a' + 'A';
+    }
+    for (uint8_t i = 0; i < legacySize; i++) {
+        if (legacyTable[i].character == ch) {
+            return legacyTable[i].pattern;
+        }
+    }
+    return 0x000000;
+}
+
+static bool legacyCharacterSupported(char ch) {
+    if (ch >= 'a' && ch <= 'z') {
+        ch = ch - 'a' + 'A';
+    }
+    for (uint8_t i = 0; i < legacySize; i++) {
+        if (legacyTable[i].character == ch) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main() {
+    buildLegacyTable();
+    HOST_CHECK_EQ(legacySize, 44);
+
+    for (uint16_t c = 0; c < 256; c++) {
+        char ch = (char)c;
+        HOST_CHECK_EQ(getCharacterPattern(ch), legacyCharacterPattern(ch));
+        HOST_CHECK_EQ(isCharacterSupported(ch), legacyCharacterSupported(ch));
+    }
+
+    // 한 줄 전체 다시 쓰기 (뒤쪽 문자일수록 선형 탐색이 길어짐)
+    static const char* const lines[] = { "1234567", "HELLO  ", "zyxwvut", "-_ 8.:Z" };
+    volatile uint32_t sink = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < LINES; i++) {
+        const char* line = lines[i & 3];
+        for (uint8_t d = 0; d < VFD_NUM_GRIDS; d++) sink = sink + legacyCharacterPattern(line[d]);
+    }
+    double legacyNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < LINES; i++) {
+        const char* line = lines[i & 3];
+        for (uint8_t d = 0; d < VFD_NUM_GRIDS; d++) sink = sink + getCharacterPattern(line[d]);
+    }
+    double denseNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("per line (%u chars): linear search %.1f ns, dense table %.1f ns (%.1fx)\n",
+           VFD_NUM_GRIDS, legacyNs / LINES, denseNs / LINES, legacyNs / denseNs);
+    HOST_CHECK(denseNs < legacyNs);
+
+    return hostTestResult();
+}
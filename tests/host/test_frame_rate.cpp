@@ -0,0 +1,185 @@
+/*
+ * test_frame_rate.cpp
+ *
+ * 목표 화면 주파수 모드 (setTargetFrameRate)
+ * - 폴링: 합성 프로필 4-16그리드에서 측정 화면 주파수 = 목표, 느린 SPI 클록/드문 refresh()에서도 유지
+ *   불가능한 목표(16그리드 500Hz)는 isFrameRateLimited()
+ * - 타이머: 실행 중 주기 변경이 Timer1을 다시 시작하지 않음
+ *   (모든 슬롯 간격과 표시 시간이 이전 주기 또는 새 주기 중 하나, 꺼지는 슬롯 없음)
+ *
+ * 16그리드 프로필을 쓰므로 VFD_MAX_GRIDS=16 라이브러리(max6921_host16)로 빌드
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define MEASURE_US  1000000UL
+
+// 속도 검사용 합성 출력 맵 (그리드 g = 체인 비트 g, 세그먼트는 7BT317NK 맵 그대로)
+static uint8_t gridFrame[16][VFD_MAP_FRAME_BYTES];
+static uint8_t gridChainBit[16];
+
+static void buildSyntheticProfile(MAX6921_TubeProfile* tube, uint8_t grids) {
+    memcpy_P(tube, &VFD_7BT317NK_PROFILE, sizeof(*tube));
+    for (uint8_t g = 0; g < 16; g++) {
+        memset(gridFrame[g], 0, sizeof(gridFrame[g]));
+        max6921SetChainBit(gridFrame[g], VFD_MAP_FRAME_BYTES, g);
+        gridChainBit[g] = g;
+    }
+    tube->numGrids = grids;
+    tube->gridFrame = &gridFrame[0][0];
+    tube->gridChainBit = gridChainBit;
+    tube->dpGrids = 0;
+    tube->colonGrids = 0;
+}
+
+// 폴링 모드: 1초 안정화 후 1초 측정
+static void runPolling(uint8_t grids, uint16_t hz, uint32_t clockHz, uint32_t every, bool expectLimited) {
+    MAX6921_TubeProfile tube;
+    buildSyntheticProfile(&tube, grids);
+
+    MAX6921_SimTransport sim(tube.numChips);
+    if (clockHz != 0) sim.setClockSpeed(clockHz);
+    hostAttachSim(sim);
+
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin(&tube));
+    vfd.setTargetFrameRate(hz);
+    vfd.displayString("12345678");
+
+    hostRunPolling(vfd, MEASURE_US, every);
+    vfd.resetScanStats();
+    uint32_t startFrames = vfd.getScanFrameCount();
+    hostRunPolling(vfd, MEASURE_US, every);
+    uint32_t frames = vfd.getScanFrameCount() - startFrames;
+
+    printf("%2u grids, target %3u Hz, clock %7u, refresh every %2u us -> period %4u us, "
+           "transfer %3u us, %4u frames/s, achieved %3u Hz, missed %u%s\n",
+           grids, hz, (unsigned)clockHz, (unsigned)every, vfd.getGridScanDelay(), vfd.getTransferTimeUs(),
+           (unsigned)frames, vfd.getAchievedFrameRate(), (unsigned)vfd.getMissedDeadlineCount(),
+           vfd.isFrameRateLimited() ? ", limited" : "");
+
+    if (expectLimited) {
+        HOST_CHECK(vfd.isFrameRateLimited());
+        HOST_CHECK(vfd.getAchievedFrameRate() < hz);
+    } else {
+        HOST_CHECK(!vfd.isFrameRateLimited());
+        HOST_CHECK_NEAR(frames, hz, 1);
+        HOST_CHECK_EQ(vfd.getAchievedFrameRate(), hz);
+    }
+}
+
+// ===== 타이머 모드 =====
+
+#define LOAD_PIN    8
+#define BLANK_PIN   7                     // 소프트웨어 BLANK (COMPB ISR)
+#define MAX_SLOTS   512
+
+// LOAD 상승 에지(ISR마다 한 번)와 BLANK LOW 구간 기록
+struct SlotRecorder {
+    uint32_t loadTimes[MAX_SLOTS];
+    uint16_t loads;
+    uint32_t onTimes[MAX_SLOTS];
+    uint16_t ons;
+    uint32_t lowSince;
+};
+
+static void onPin(void* context, uint8_t pin, uint8_t level) {
+    SlotRecorder* recorder = static_cast<SlotRecorder*>(context);
+    if (pin == LOAD_PIN && level == HIGH && recorder->loads < MAX_SLOTS) {
+        recorder->loadTimes[recorder->loads++] = micros();
+    } else if (pin == BLANK_PIN) {
+        if (level == LOW) {
+            recorder->lowSince = micros();
+        } else if (recorder->lowSince != 0) {
+            if (recorder->ons < MAX_SLOTS) recorder->onTimes[recorder->ons++] = micros() - recorder->lowSince;
+            recorder->lowSince = 0;
+        }
+    }
+}
+
+static bool isOneOf(uint32_t value, uint32_t a, uint32_t b, uint32_t tolerance) {
+    return (value + tolerance >= a && value <= a + tolerance) ||
+           (value + tolerance >= b && value <= b + tolerance);
+}
+
+static void runTimerRetime() {
+    printf("-- timer mode: period change while scanning\n");
+    hostDetachClock();
+    hostResetTimer1();
+    static SlotRecorder recorder;
+    memset(&recorder, 0, sizeof(recorder));
+
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("1234567");
+    HOST_CHECK(vfd.beginTimerScan(DEFAULT_GRID_SCAN_DELAY_US));
+    hostAttachPinListener(onPin, &recorder);
+    hostRunPolling(vfd, DEFAULT_GRID_SCAN_DELAY_US * 3, 10);
+
+    // 슬롯 중간에서 주기 변경 (목표 100Hz → 7그리드 1428us)
+    uint32_t oldPeriod = vfd.getGridScanDelay();
+    hostAdvance(700);
+    vfd.setTargetFrameRate(100);
+    uint32_t newPeriod = vfd.getGridScanDelay();
+    HOST_CHECK(newPeriod != oldPeriod);
+    hostRunPolling(vfd, 100000, 10);
+    hostAttachPinListener(NULL, NULL);
+
+    // 슬롯 간격: 이전 주기 아니면 새 주기 (카운터 재시작이면 그 사이 값이 나옴)
+    uint16_t mismatched = 0;
+    uint16_t newSlots = 0;
+    for (uint16_t i = 1; i < recorder.loads; i++) {
+        uint32_t interval = recorder.loadTimes[i] - recorder.loadTimes[i - 1];
+        if (!isOneOf(interval, oldPeriod, newPeriod, 1)) {
+            printf("slot %u: interval %u us\n", i, (unsigned)interval);
+            mismatched++;
+        }
+        if (interval + 1 >= newPeriod && interval <= newPeriod + 1) newSlots++;
+    }
+    HOST_CHECK_EQ(mismatched, 0);
+    HOST_CHECK(newSlots > 60);
+
+    // 표시 시간: 이전/새 주기의 최대 밝기 표시 시간 중 하나 (꺼지거나 잘린 슬롯 없음)
+    uint32_t reserve = DEFAULT_BLANK_GUARD_US;
+    uint32_t oldOn = oldPeriod - reserve;
+    uint32_t newOn = newPeriod - reserve;
+    uint16_t badOn = 0;
+    for (uint16_t i = 0; i < recorder.ons; i++) {
+        if (!isOneOf(recorder.onTimes[i], oldOn, newOn, 2)) {
+            printf("slot %u: on %u us\n", i, (unsigned)recorder.onTimes[i]);
+            badOn++;
+        }
+    }
+    HOST_CHECK_EQ(badOn, 0);
+    HOST_CHECK(recorder.ons + 1 >= recorder.loads);
+    printf("period %u -> %u us: %u slots, on %u -> %u us, achieved %u Hz\n",
+           (unsigned)oldPeriod, (unsigned)newPeriod, recorder.loads,
+           (unsigned)oldOn, (unsigned)newOn, vfd.getAchievedFrameRate());
+    HOST_CHECK_EQ(vfd.getAchievedFrameRate(), 100);
+
+    vfd.endTimerScan();
+}
+
+int main() {
+    for (uint8_t grids = 4; grids <= 16; grids++) {
+        runPolling(grids, 60, 4000000, 1, false);
+    }
+    for (uint8_t grids = 4; grids <= 16; grids += 4) {
+        runPolling(grids, 100, 4000000, 1, false);
+    }
+    for (uint8_t grids = 4; grids <= 16; grids += 4) {
+        runPolling(grids, 60, 500000, 1, false);         // 느린 클록: 전송 80us
+    }
+    runPolling(16, 60, 0, 37, false);                    // 드문 refresh()
+    runPolling(16, 500, 4000000, 1, true);               // 불가능한 목표
+
+    runTimerRetime();
+    return hostTestResult();
+}
@@ -0,0 +1,69 @@
+/*
+ * test_ghost.cpp
+ *
+ * 고스트 에너지 (출력 잔류 10us 유리 모델, 7BT317NK "1234567", 2000us 슬롯, 140ms)
+ * - refresh()를 자주 부르면 표시 구간 끝 BLANK가 다음 슬롯까지 유지되어 가드 없이도 고스트 0
+ * - refresh()가 드물면(97us) BLANK와 LOAD가 같은 호출에서 일어나 고스트가 생기고, lead 10us로 0
+ * - 순차/교차 스캔 순서 모두, 4MHz 비동기 전송은 전송 시간이 lead 역할
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define OUTPUT_DECAY_US  10
+#define RUN_US           140000UL
+
+static uint32_t runGhost(const char* name, uint8_t order, uint16_t leadUs, uint32_t clockHz, uint32_t every) {
+    VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS, VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+    glass.setOutputDecay(OUTPUT_DECAY_US);
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+    if (clockHz != 0) sim.setClockSpeed(clockHz);
+    hostAttachSim(sim);
+
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.setScanOrder(order);
+    vfd.setBlankGuard(leadUs, 0);
+    vfd.displayString("1234567");
+
+    hostRunPolling(vfd, RUN_US, every);
+
+    uint32_t on = 0;
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        for (uint8_t segment = 0; segment < VFD_NUM_SEGMENTS; segment++) {
+            on += glass.getSegmentOnTime(grid, segment);
+        }
+    }
+    uint32_t ghost = glass.getTotalGhostTime();
+    printf("%-42s ghost %5u us, on %7u us (%.2f%%)\n", name, (unsigned)ghost, (unsigned)on,
+           on ? 100.0 * ghost / on : 0.0);
+
+    HOST_CHECK(on > 0);
+    HOST_CHECK_EQ(glass.getOverlapTime(), 0);
+    HOST_CHECK_EQ(sim.getChain().getShortLatchCount(), 0);
+    return ghost;
+}
+
+int main() {
+    // refresh() 1us 간격: 가드 없이도 고스트 없음
+    HOST_CHECK_EQ(runGhost("sequential, lead 0, loop 1us", MAX6921_SCAN_SEQUENTIAL, 0, 0, 1), 0);
+    HOST_CHECK_EQ(runGhost("interleaved, lead 0, loop 1us", MAX6921_SCAN_INTERLEAVED, 0, 0, 1), 0);
+
+    // refresh() 97us 간격: lead 가드가 고스트를 없앰
+    HOST_CHECK(runGhost("sequential, lead 0, loop 97us", MAX6921_SCAN_SEQUENTIAL, 0, 0, 97) > 0);
+    HOST_CHECK_EQ(runGhost("sequential, lead 10, loop 97us", MAX6921_SCAN_SEQUENTIAL, 10, 0, 97), 0);
+    HOST_CHECK(runGhost("interleaved, lead 0, loop 97us", MAX6921_SCAN_INTERLEAVED, 0, 0, 97) > 0);
+    HOST_CHECK_EQ(runGhost("interleaved, lead 10, loop 97us", MAX6921_SCAN_INTERLEAVED, 10, 0, 97), 0);
+
+    // 4MHz 비동기 전송: 40비트 전송 10us가 lead 역할
+    HOST_CHECK_EQ(runGhost("sequential, lead 0, async 4MHz", MAX6921_SCAN_SEQUENTIAL, 0, 4000000, 1), 0);
+    HOST_CHECK_EQ(runGhost("sequential, lead 0, async 4MHz, loop 97us", MAX6921_SCAN_SEQUENTIAL, 0, 4000000, 97), 0);
+
+    hostDetachClock();
+    return hostTestResult();
+}
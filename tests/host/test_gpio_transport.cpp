@@ -0,0 +1,170 @@
+/*
+ * test_gpio_transport.cpp
+ *
+ * GPIO 비트뱅 전송 (MAX6921_GPIOTransport, 호스트는 digitalWrite() 경로)
+ * - DIN/CLK/LOAD 핀 변화를 shim 사이클 시계로 기록하고 데이터시트 최소 시간과 비교
+ *   tDS 5, tDH 20, tCH 90, tCL 90, tCP 200, tCSH 100, tCSW 55 (ns)
+ * - 비트 순서: CLK 상승마다 샘플한 DIN = 프레임 바이트 MSB First, 클록 수 = 프레임 비트 수
+ * - LOAD는 첫 클록 전에 내려가고 마지막 클록 뒤에만 올라감 (LOAD HIGH 동안 클록 없음)
+ * - 가상 체인의 래치 = 같은 프레임을 SPI 경로(MAX6921_SimTransport)로 보낸 래치
+ * 기본(16MHz)과 240MHz 구성으로 빌드 (빠른 MCU에서는 지연 삽입으로 최소 시간 보장)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "MAX6921_GPIOTransport.h"
+#include "host_test.h"
+
+#define DIN_PIN     7
+#define CLK_PIN     6
+#define LOAD_PIN    5
+
+// 데이터시트 Timing Characteristics (ns)
+#define T_DS        5
+#define T_DH        20
+#define T_CH        90
+#define T_CL        90
+#define T_CP        200
+#define T_CSH       100
+#define T_CSW       55
+
+#define NO_EDGE     0xFFFFFFFFFFFFFFFFULL
+
+struct Bus {
+    MAX6921_SimChain* chain;
+    uint8_t din, clk, load;
+    uint64_t dinEdge, clkRise, clkFall, loadRise, loadFall;
+
+    uint8_t bits[VFD_MAX_FRAME_BYTES * 8];
+    uint16_t clocks;
+    uint32_t clocksWhileLoadHigh;
+    uint32_t loadRiseBeforeClock;         // 클록 없이 올라간 LOAD
+
+    // 최소 측정값 (ns)
+    double minSetup, minHold, minHigh, minLow, minPeriod, minLoadSetup, minLoadHigh;
+};
+
+static Bus bus;
+
+static double ns(uint64_t cycles) {
+    return (double)cycles * 1e9 / (double)F_CPU;
+}
+
+static void keepMin(double& current, double value) {
+    if (value < current) current = value;
+}
+
+static void onPin(void* context, uint8_t pin, uint8_t value) {
+    (void)context;
+    uint64_t now = hostGetCycleCount();
+
+    if (pin == DIN_PIN) {
+        if (value == bus.din) return;
+        if (bus.clkRise != NO_EDGE) keepMin(bus.minHold, ns(now - bus.clkRise));  // 직전 샘플 에지 이후
+        bus.dinEdge = now;
+        bus.din = value;
+    } else if (pin == CLK_PIN && value != bus.clk) {
+        if (value == HIGH) {
+            if (bus.dinEdge != NO_EDGE) keepMin(bus.minSetup, ns(now - bus.dinEdge));
+            if (bus.clkFall != NO_EDGE) keepMin(bus.minLow, ns(now - bus.clkFall));
+            if (bus.clkRise != NO_EDGE) keepMin(bus.minPeriod, ns(now - bus.clkRise));
+            if (bus.load == HIGH) bus.clocksWhileLoadHigh++;
+            if (bus.clocks < sizeof(bus.bits)) bus.bits[bus.clocks] = bus.din;
+            bus.clocks++;
+            bus.chain->clock(bus.din == HIGH);
+            bus.clkRise = now;
+        } else {
+            keepMin(bus.minHigh, ns(now - bus.clkRise));
+            bus.clkFall = now;
+        }
+        bus.clk = value;
+    } else if (pin == LOAD_PIN && value != bus.load) {
+        if (value == HIGH) {
+            if (bus.clocks == 0) bus.loadRiseBeforeClock++;
+            else keepMin(bus.minLoadSetup, ns(now - bus.clkRise));
+            bus.loadRise = now;
+        } else {
+            if (bus.loadRise != NO_EDGE) keepMin(bus.minLoadHigh, ns(now - bus.loadRise));
+            bus.loadFall = now;
+        }
+        bus.load = value;
+        bus.chain->setLoad(value == HIGH);
+    }
+}
+
+static void resetFrame() {
+    bus.clocks = 0;
+}
+
+int main() {
+    memset(&bus, 0, sizeof(bus));
+    bus.dinEdge = bus.clkRise = bus.clkFall = bus.loadRise = bus.loadFall = NO_EDGE;
+    bus.minSetup = bus.minHold = bus.minHigh = bus.minLow = bus.minPeriod = 1e9;
+    bus.minLoadSetup = bus.minLoadHigh = 1e9;
+
+    MAX6921_SimChain chain(VFD_REQUIRED_CHIPS);
+    bus.chain = &chain;
+    hostAttachPinListener(onPin, NULL);
+
+    MAX6921_GPIOTransport<DIN_PIN, CLK_PIN, LOAD_PIN> gpio;
+    gpio.begin();
+    HOST_CHECK_EQ(bus.load, HIGH);
+    HOST_CHECK_EQ(bus.clk, LOW);
+    bus.loadRiseBeforeClock = 0;
+
+    // 기준: 같은 프레임을 SPI 경로로 보낸 가상 체인
+    MAX6921_SimTransport reference(VFD_REQUIRED_CHIPS);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&reference);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("8.8:4A-7");
+
+    uint32_t bitErrors = 0;
+    uint32_t latchErrors = 0;
+    uint8_t length = vfd.getFrameBytes();
+    for (uint8_t slot = 0; slot < VFD_NUM_GRIDS * 3; slot++) {
+        const uint8_t* frame = vfd.advanceScan();
+        reference.send(frame, length);
+
+        resetFrame();
+        uint64_t start = hostGetCycleCount();
+        gpio.send(frame, length);
+        HOST_CHECK(bus.loadFall >= start);
+        HOST_CHECK(bus.loadRise > bus.clkRise);
+        HOST_CHECK_EQ(bus.clocks, length * 8);
+
+        for (uint16_t i = 0; i < length * 8 && i < bus.clocks; i++) {
+            uint8_t expected = (frame[i / 8] >> (7 - i % 8)) & 1;
+            if (bus.bits[i] != expected) bitErrors++;
+        }
+        for (uint8_t bit = 0; bit < chain.getNumBits(); bit++) {
+            if (chain.getLatch(bit) != reference.getChain().getLatch(bit)) latchErrors++;
+        }
+    }
+
+    printf("GPIO @ %lu MHz: tDS %.1f, tDH %.1f, tCH %.1f, tCL %.1f, tCP %.1f, tCSH %.1f, tCSW %.1f ns (min)\n",
+           (unsigned long)(F_CPU / 1000000UL), bus.minSetup, bus.minHold, bus.minHigh, bus.minLow,
+           bus.minPeriod, bus.minLoadSetup, bus.minLoadHigh);
+
+    HOST_CHECK_EQ(bitErrors, 0);
+    HOST_CHECK_EQ(latchErrors, 0);
+    HOST_CHECK_EQ(bus.clocksWhileLoadHigh, 0);
+    HOST_CHECK_EQ(bus.loadRiseBeforeClock, 0);
+    HOST_CHECK_EQ(chain.getShortLatchCount(), 0);
+    HOST_CHECK_EQ(chain.getTransparentClockCount(), 0);
+
+    HOST_CHECK(bus.minSetup >= T_DS);
+    HOST_CHECK(bus.minHold >= T_DH);
+    HOST_CHECK(bus.minHigh >= T_CH);
+    HOST_CHECK(bus.minLow >= T_CL);
+    HOST_CHECK(bus.minPeriod >= T_CP);
+    HOST_CHECK(bus.minLoadSetup >= T_CSH);
+    HOST_CHECK(bus.minLoadHigh >= T_CSW);
+
+    hostAttachPinListener(NULL, NULL);
+    return hostTestResult();
+}
@@ -0,0 +1,127 @@
+/*
+ * test_hot_path.cpp
+ *
+ * 스캔 핫패스: 미리 계산된 그리드 프레임 vs 이전 방식 (그리드마다 비트 연산 + 6바이트 sendData)
+ * - 비트 동일성: 미리 계산된 프레임을 가상 체인에 래치한 출력 = 이전 방식의 칩 워드
+ *   (data1 = 그리드 비트 | P0-P12 << 7, data2 = P13-P20)
+ * - 시간: 그리드 1개당 와이어 바이트를 만드는 호스트 시간 (참고값, SPI 전송은 제외)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <chrono>
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define ITERATIONS  700000UL
+
+static volatile uint8_t wireSink;
+
+static inline void wire(uint8_t byte) {
+    wireSink = wireSink ^ byte;
+}
+
+// 이전 refresh() + sendData(): 그리드마다 칩 워드를 계산하고 칩당 3바이트로 나눠 전송
+static void legacyWords(uint8_t grid, uint32_t segmentData, uint32_t* data1, uint32_t* data2) {
+    uint32_t gridPattern = (1UL << grid);
+    uint32_t segments1 = segmentData & 0b1111111111111;        // P0-P12 (13 bits)
+    uint32_t segments2 = (segmentData >> 13) & 0b11111111;     // P13-P20 (8 bits)
+    *data1 = gridPattern | (segments1 << 7);
+    *data2 = segments2;
+}
+
+static void legacySend(uint32_t data1, uint32_t data2) {
+    wire((data2 >> 16) & 0b00001111);
+    wire((data2 >> 8) & 0b11111111);
+    wire(data2 & 0b11111111);
+    wire((data1 >> 16) & 0b00001111);
+    wire((data1 >> 8) & 0b11111111);
+    wire(data1 & 0b11111111);
+}
+
+static uint32_t chainWord(const MAX6921_SimChain& chain, uint8_t chip) {
+    uint32_t word = 0;
+    for (uint8_t bit = 0; bit < MAX6921_OUTPUT_BITS; bit++) {
+        if (chain.getLatch(chip * MAX6921_OUTPUT_BITS + bit)) word |= 1UL << bit;
+    }
+    return word;
+}
+
+static void checkBitIdentical(const char* text) {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString(text);
+
+    // 새 화면은 프레임 경계(슬롯 0)에서 표시 버퍼로 넘어감
+    for (uint8_t i = 0; i < VFD_NUM_GRIDS; i++) vfd.advanceScan();
+
+    uint8_t seen = 0;
+    for (uint8_t i = 0; i < VFD_NUM_GRIDS; i++) {
+        sim.send(vfd.advanceScan(), vfd.getFrameBytes());
+
+        // 래치된 그리드 비트(체인 비트 0-6)로 그리드 번호
+        uint32_t gridBits = chainWord(sim.getChain(), 0) & ((1UL << VFD_NUM_GRIDS) - 1);
+        uint8_t grid = 0;
+        while (grid < VFD_NUM_GRIDS && gridBits != (1UL << grid)) grid++;
+        HOST_CHECK(grid < VFD_NUM_GRIDS);
+        if (grid >= VFD_NUM_GRIDS) continue;
+
+        uint32_t data1, data2;
+        legacyWords(grid, getCharacterPattern(text[grid]), &data1, &data2);
+        HOST_CHECK_EQ(chainWord(sim.getChain(), 0), data1);
+        HOST_CHECK_EQ(chainWord(sim.getChain(), 1), data2);
+        seen |= (uint8_t)(1U << grid);
+    }
+    HOST_CHECK_EQ(seen, (1U << VFD_NUM_GRIDS) - 1);
+}
+
+int main() {
+    checkBitIdentical("1234567");
+    checkBitIdentical("8888888");
+    checkBitIdentical("HELLO  ");
+    checkBitIdentical("-_=AZ09");
+
+    // 호스트 시간 비교 (그리드 1개분 와이어 바이트 생성)
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("1234567");
+
+    uint32_t gridData[VFD_NUM_GRIDS];
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        gridData[grid] = getCharacterPattern("1234567"[grid]);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint8_t grid = 0;
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        grid = (uint8_t)((grid + 1) % VFD_NUM_GRIDS);
+        uint32_t data1, data2;
+        legacyWords(grid, gridData[grid], &data1, &data2);
+        legacySend(data1, data2);
+    }
+    double legacyNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    uint8_t frameBytes = vfd.getFrameBytes();
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        const uint8_t* frame = vfd.advanceScan();
+        for (uint8_t b = 0; b < frameBytes; b++) wire(frame[b]);
+    }
+    double frameNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("per grid: legacy bit math + 6 bytes %.1f ns, precomputed frame (scan step + %u bytes) %.1f ns\n",
+           legacyNs / ITERATIONS, frameBytes, frameNs / ITERATIONS);
+    HOST_CHECK_EQ(frameBytes, 5);                // 40비트 체인을 빈틈없이 (이전 6바이트)
+
+    hostDetachClock();
+    return hostTestResult();
+}
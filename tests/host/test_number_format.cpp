@@ -0,0 +1,192 @@
+/*
+ * test_number_format.cpp
+ *
+ * 숫자 표시 (displayNumber / displayFixed / displayFloat)
+ * - 스캔 프레임이 snprintf() 문자열을 displayString()으로 표시한 것과 같음 (정렬, 부호, 소수점, 앞자리 0, 자리 넘침)
+ * - defineGlyph()로 숫자/'-'를 덮어쓰면 숫자 표시에도 적용, removeGlyph() 뒤에는 숫자 테이블 패턴
+ * - 덮어쓴 글리프가 표시된 상태에서 같은 값을 다시 그리면 조회/재인코딩 없음
+ * - snprintf() + displayString() 경로와 시간 비교
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define METER_COUNT     100000L
+#define SEVEN_GLYPH     0x00007FUL
+#define DASH_GLYPH      0x1C0000UL
+
+struct Frame {
+    uint8_t bytes[VFD_NUM_GRIDS][VFD_MAX_FRAME_BYTES];
+};
+
+// 2화면 스캔 (플립 대기 화면 소비) 후 마지막 화면의 그리드 프레임
+static void captureFrame(MAX6921_VFD_Driver& vfd, Frame& frame) {
+    for (uint8_t slot = 0; slot < VFD_NUM_GRIDS * 2; slot++) {
+        const uint8_t* bytes = vfd.advanceScan();
+        memcpy(frame.bytes[slot % VFD_NUM_GRIDS], bytes, vfd.getFrameBytes());
+    }
+}
+
+static bool sameFrame(MAX6921_VFD_Driver& a, MAX6921_VFD_Driver& b) {
+    Frame fa, fb;
+    memset(&fa, 0, sizeof(fa));
+    memset(&fb, 0, sizeof(fb));
+    captureFrame(a, fa);
+    captureFrame(b, fb);
+    return memcmp(&fa, &fb, sizeof(fa)) == 0;
+}
+
+// 고정소수점 기준 문자열: 오른쪽 정렬, 최소 decimals + 1자리, 자리가 모자라면 모두 '-'
+static void formatFixed(long value, uint8_t decimals, bool leadingZeros, char* out) {
+    unsigned long magnitude = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+    char digits[24];
+    snprintf(digits, sizeof(digits), "%0*lu", decimals + 1, magnitude);
+    uint8_t count = (uint8_t)strlen(digits);
+    uint8_t width = VFD_NUM_GRIDS - (value < 0 ? 1 : 0);
+    if (count > width) {
+        memset(out, '-', VFD_NUM_GRIDS);
+        out[VFD_NUM_GRIDS] = '\0';
+        return;
+    }
+    if (leadingZeros) {
+        snprintf(digits, sizeof(digits), "%0*lu", width, magnitude);
+        count = width;
+    }
+
+    char* p = out;
+    for (uint8_t i = 0; i < VFD_NUM_GRIDS - count - (value < 0 ? 1 : 0); i++) *p++ = ' ';
+    if (value < 0) *p++ = '-';
+    for (uint8_t i = 0; i < count; i++) {
+        *p++ = digits[i];
+        if (decimals > 0 && i == count - 1 - decimals) *p++ = '.';
+    }
+    *p = '\0';
+}
+
+static void checkFixed(MAX6921_VFD_Driver& vfd, MAX6921_VFD_Driver& ref, long value, uint8_t decimals, bool leadingZeros) {
+    char text[24];
+    formatFixed(value, decimals, leadingZeros, text);
+    vfd.displayFixed(value, decimals, leadingZeros);
+    ref.displayString(text);
+
+    hostChecks++;
+    if (!sameFrame(vfd, ref)) {
+        hostFailures++;
+        printf("FAIL displayFixed(%ld, %u, %d) != \"%s\"\n", value, decimals, leadingZeros, text);
+    }
+}
+
+static void checkFloat(MAX6921_VFD_Driver& vfd, MAX6921_VFD_Driver& ref, float value, uint8_t decimals, const char* expected) {
+    vfd.displayFloat(value, decimals);
+    ref.displayString(expected);
+
+    hostChecks++;
+    if (!sameFrame(vfd, ref)) {
+        hostFailures++;
+        printf("FAIL displayFloat(%f, %u) != \"%s\"\n", (double)value, decimals, expected);
+    }
+}
+
+// 글리프를 직접 반영한 기준 화면 (setFrame)
+static void showExpected(MAX6921_VFD_Driver& ref, const char* text) {
+    VFD_SegmentMask masks[VFD_NUM_GRIDS];
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        char ch = text[grid];
+        masks[grid] = (VFD_SegmentMask)(ch == '7' ? SEVEN_GLYPH : ch == '-' ? DASH_GLYPH : getCharacterPattern(ch));
+    }
+    ref.setFrame(masks);
+}
+
+int main() {
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    MAX6921_VFD_Driver ref(11, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    HOST_CHECK(ref.begin());
+
+    // 정수/고정소수점
+    static const long values[] = { 0, 5, 42, -42, 1234, -1234, 99999, 123456, -123456, 1234567,
+                                   -1234567, 9999999, 10000000, 2147483647L, -2147483647L };
+    for (uint8_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        for (uint8_t decimals = 0; decimals <= 7; decimals++) {
+            checkFixed(vfd, ref, values[i], decimals, false);
+            checkFixed(vfd, ref, values[i], decimals, true);
+        }
+    }
+
+    // 부동소수점 (반올림, NaN/범위 밖은 자리 넘침)
+    checkFloat(vfd, ref, 3.14159f, 2, "    3.14");
+    checkFloat(vfd, ref, -0.005f, 2, "   -0.01");
+    checkFloat(vfd, ref, 99.96f, 1, "   100.0");
+    checkFloat(vfd, ref, -2.5f, 0, "     -3");
+    checkFloat(vfd, ref, 1e12f, 2, "-------");
+
+    // 덮어쓰기 글리프: 숫자와 부호 모두 적용
+    HOST_CHECK(vfd.defineGlyph('7', SEVEN_GLYPH));
+    HOST_CHECK(vfd.defineGlyph('-', DASH_GLYPH));
+    vfd.displayNumber(-1777L);
+    showExpected(ref, "  -1777");
+    HOST_CHECK(sameFrame(vfd, ref));
+
+    // 소수점은 displayString() 경로의 같은 글리프 등록과 비교
+    vfd.displayFixed(-7, 2);
+    HOST_CHECK(ref.defineGlyph('7', SEVEN_GLYPH));
+    HOST_CHECK(ref.defineGlyph('-', DASH_GLYPH));
+    ref.displayString("   -0.07");
+    HOST_CHECK(sameFrame(vfd, ref));
+    ref.clearGlyphs();
+
+    vfd.displayNumber(12345678L);
+    showExpected(ref, "-------");
+    HOST_CHECK(sameFrame(vfd, ref));
+
+    // 표시된 글리프 자리를 같은 값으로 다시 그리면 아무 것도 하지 않음
+    vfd.displayNumber(-1777L);
+    uint32_t lookups = vfd.getFontLookupCount();
+    vfd.displayNumber(-1777L);
+    HOST_CHECK_EQ(vfd.getLastRebuildCount(), 0);
+    HOST_CHECK_EQ(vfd.getFontLookupCount(), lookups);
+
+    // 등록 전에 표시한 숫자도 즉시 바뀌고, 해제하면 숫자 테이블 패턴으로 돌아감
+    HOST_CHECK(vfd.removeGlyph('7'));
+    HOST_CHECK(vfd.removeGlyph('-'));
+    ref.displayString("  -1777");
+    HOST_CHECK(sameFrame(vfd, ref));
+    HOST_CHECK(vfd.defineGlyph('7', SEVEN_GLYPH));
+    showExpected(ref, "  -1777");
+    ref.displayCharacter(2, '-');
+    HOST_CHECK(sameFrame(vfd, ref));
+    HOST_CHECK(vfd.removeGlyph('7'));
+    vfd.displayNumber(7L);
+    ref.displayString("      7");
+    HOST_CHECK(sameFrame(vfd, ref));
+
+    // 계기 갱신: snprintf() + displayString() 대비
+    char text[VFD_NUM_GRIDS + 1];
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long value = 0; value < METER_COUNT; value++) {
+        snprintf(text, sizeof(text), "%*ld", VFD_NUM_GRIDS, value);
+        ref.displayString(text);
+    }
+    double printfNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (long value = 0; value < METER_COUNT; value++) {
+        vfd.displayNumber(value);
+    }
+    double directNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("per update: snprintf + displayString %.1f ns, displayNumber %.1f ns (%.1fx)\n",
+           printfNs / METER_COUNT, directNs / METER_COUNT, printfNs / directNs);
+    HOST_CHECK(sameFrame(vfd, ref));
+    HOST_CHECK(directNs < printfNs);
+
+    return hostTestResult();
+}
@@ -0,0 +1,276 @@
+/*
+ * test_serial_loopback.cpp
+ *
+ * 시리얼 프로토콜 루프백 (115200 baud, 시뮬레이션 시간)
+ * 호스트 인코더 → 가상 UART(바이트당 10비트, 수신 버퍼 64바이트) → loop() { proto.poll(uart); vfd.refresh(); }
+ * → 응답 프레임이 호스트에 도착할 때까지
+ * - 지연: TEXT 1개를 보내고 응답을 받은 뒤 다음을 보냄, 왕복 = 선로 시간(요청 + 응답 바이트) + loop() 간격 이내
+ * - 처리량: 응답을 기다리지 않고 연속 전송, 모든 프레임 반영 + 유실 0이면 선로 속도 그대로 (loop() 간격별)
+ * - 마퀴 번호 재사용: 프로토콜 마퀴가 끝난 뒤 같은 번호를 쓰는 효과는 다음 프로토콜 마퀴가 멈추지 않음
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "MAX6921_SerialProtocol.h"
+#include "host_test.h"
+
+#define BAUD            115200UL
+#define BYTE_NS         (10UL * 1000000000UL / BAUD)   // 시작 + 8 데이터 + 정지 비트
+#define UART_RX_SIZE    64                             // AVR HardwareSerial 수신 버퍼
+#define REPLY_BYTES     5
+#define LATENCY_FRAMES  100
+#define STREAM_FRAMES   500
+#define MAX_STREAM      (STREAM_FRAMES * (MAX6921_PROTO_MAX_PAYLOAD + 4))
+
+// 가상 UART: 호스트가 보낸 바이트는 도착 시각이 되면 수신 버퍼로, MCU가 쓴 바이트는 송신 선로 시간 뒤 호스트에 도착
+class SimUart : public Stream {
+private:
+    const uint8_t* _tx;                   // 호스트 → MCU 바이트열
+    uint32_t _txLength;
+    uint32_t _txIndex;
+    uint64_t _txStartNs;
+    uint8_t _rx[UART_RX_SIZE];
+    uint8_t _rxHead;
+    uint8_t _rxCount;
+    uint64_t _replyFreeNs;                // MCU 송신 선로가 비는 시각
+
+public:
+    uint32_t lostBytes;                   // 수신 버퍼가 가득 차 버려진 바이트
+    uint32_t replyBytes;
+    uint64_t lastReplyNs;                 // 마지막 응답 바이트가 호스트에 도착한 시각
+
+    SimUart() : _tx(NULL), _txLength(0), _txIndex(0), _txStartNs(0), _rxHead(0), _rxCount(0),
+                _replyFreeNs(0), lostBytes(0), replyBytes(0), lastReplyNs(0) {}
+
+    static uint64_t nowNs() { return (uint64_t)micros() * 1000ULL; }
+
+    // 호스트가 지금부터 data를 연속 전송
+    void hostSend(const uint8_t* data, uint32_t length) {
+        _tx = data;
+        _txLength = length;
+        _txIndex = 0;
+        _txStartNs = nowNs();
+    }
+
+    bool hostDone() const { return _txIndex >= _txLength; }
+    uint64_t hostSendEndNs() const { return _txStartNs + (uint64_t)_txLength * BYTE_NS; }
+
+    // 도착한 바이트를 수신 버퍼로 (UART 수신 인터럽트)
+    void deliver() {
+        uint64_t now = nowNs();
+        while (_txIndex < _txLength && _txStartNs + (uint64_t)(_txIndex + 1) * BYTE_NS <= now) {
+            if (_rxCount < UART_RX_SIZE) {
+                _rx[(_rxHead + _rxCount) % UART_RX_SIZE] = _tx[_txIndex];
+                _rxCount++;
+            } else {
+                lostBytes++;
+            }
+            _txIndex++;
+        }
+    }
+
+    virtual int available() { return _rxCount; }
+    virtual int peek() { return _rxCount ? _rx[_rxHead] : -1; }
+    virtual int read() {
+        if (_rxCount == 0) return -1;
+        uint8_t byte = _rx[_rxHead];
+        _rxHead = (uint8_t)((_rxHead + 1) % UART_RX_SIZE);
+        _rxCount--;
+        return byte;
+    }
+
+    virtual size_t write(uint8_t byte) {
+        (void)byte;
+        uint64_t start = (_replyFreeNs > nowNs()) ? _replyFreeNs : nowNs();
+        _replyFreeNs = start + BYTE_NS;
+        lastReplyNs = _replyFreeNs;
+        replyBytes++;
+        return 1;
+    }
+    using Print::write;
+};
+
+// 기준 인코더 (tools/vfd_serial.py와 같은 형식)
+static uint32_t encodeFrame(uint8_t command, const uint8_t* payload, uint8_t length, uint8_t* out) {
+    uint8_t crc = MAX6921_SerialProtocol::crc8(MAX6921_SerialProtocol::crc8(0, command), length);
+    out[0] = MAX6921_PROTO_SYNC;
+    out[1] = command;
+    out[2] = length;
+    for (uint8_t i = 0; i < length; i++) {
+        out[3 + i] = payload[i];
+        crc = MAX6921_SerialProtocol::crc8(crc, payload[i]);
+    }
+    out[3 + length] = crc;
+    return 4 + length;
+}
+
+static uint32_t encodeText(const char* text, uint8_t* out) {
+    return encodeFrame(MAX6921_CMD_TEXT, (const uint8_t*)text, (uint8_t)strlen(text), out);
+}
+
+// 가상 MCU loop(): loopUs마다 poll + refresh, 그 사이 1us마다 UART 수신
+static void runLoop(MAX6921_SerialProtocol& proto, MAX6921_VFD_Driver& vfd, SimUart& uart,
+                    uint32_t loopUs, uint32_t& sinceLoop) {
+    uart.deliver();
+    if (++sinceLoop >= loopUs) {
+        sinceLoop = 0;
+        proto.poll(uart);
+        vfd.refresh();
+    }
+    hostAdvance(1);
+}
+
+static void measureLatency(uint32_t loopUs) {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    MAX6921_SerialProtocol proto(&vfd);
+    SimUart uart;
+
+    uint8_t frame[MAX6921_PROTO_MAX_PAYLOAD + 4];
+    uint32_t sinceLoop = 0;
+    uint64_t minNs = ~0ULL, maxNs = 0, totalNs = 0;
+    uint32_t frameBytes = 0;
+
+    for (uint32_t i = 0; i < LATENCY_FRAMES; i++) {
+        char text[VFD_NUM_GRIDS + 1];
+        snprintf(text, sizeof(text), "%7u", (unsigned)(i * 37));
+        frameBytes = encodeText(text, frame);
+
+        uint32_t replies = uart.replyBytes;
+        uint64_t sentNs = SimUart::nowNs();
+        uart.hostSend(frame, frameBytes);
+        // 응답 5바이트가 모두 호스트에 도착할 때까지
+        while (uart.replyBytes < replies + REPLY_BYTES || SimUart::nowNs() < uart.lastReplyNs) {
+            runLoop(proto, vfd, uart, loopUs, sinceLoop);
+        }
+        uint64_t latency = uart.lastReplyNs - sentNs;
+        if (latency < minNs) minNs = latency;
+        if (latency > maxNs) maxNs = latency;
+        totalNs += latency;
+    }
+
+    uint64_t wireNs = (uint64_t)(frameBytes + REPLY_BYTES) * BYTE_NS;
+    printf("latency, loop %5u us: %u-byte TEXT + %u-byte reply, min %.2f ms, avg %.2f ms, max %.2f ms (wire %.2f ms)\n",
+           (unsigned)loopUs, (unsigned)frameBytes, REPLY_BYTES, minNs / 1e6, totalNs / 1e6 / LATENCY_FRAMES,
+           maxNs / 1e6, wireNs / 1e6);
+    HOST_CHECK(minNs >= wireNs);
+    HOST_CHECK(maxNs <= wireNs + (uint64_t)(loopUs + 2) * 1000ULL);
+    HOST_CHECK_EQ(proto.getFrameCount(), LATENCY_FRAMES);
+    HOST_CHECK_EQ(proto.getErrorCount(), 0);
+    HOST_CHECK_EQ(uart.lostBytes, 0);
+
+    hostDetachClock();
+}
+
+// 응답을 기다리지 않고 연속 전송, 반환값 = 유실 바이트 수
+static uint32_t measureRate(uint32_t loopUs) {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    MAX6921_SerialProtocol proto(&vfd);
+    SimUart uart;
+
+    static uint8_t stream[MAX_STREAM];
+    uint32_t length = 0;
+    char text[VFD_NUM_GRIDS + 1];
+    for (uint32_t i = 0; i < STREAM_FRAMES; i++) {
+        snprintf(text, sizeof(text), "%7u", (unsigned)(i * 7919 % 10000000));
+        length += encodeText(text, &stream[length]);
+    }
+
+    uint32_t sinceLoop = 0;
+    uint64_t startNs = SimUart::nowNs();
+    uart.hostSend(stream, length);
+    while (!uart.hostDone()) runLoop(proto, vfd, uart, loopUs, sinceLoop);
+    for (uint32_t t = 0; t < loopUs + 1; t++) runLoop(proto, vfd, uart, loopUs, sinceLoop);
+
+    double seconds = (uart.hostSendEndNs() - startNs) / 1e9;
+    double wireRate = (double)BAUD / 10 / (length / STREAM_FRAMES);
+    printf("rate, loop %5u us: %u frames in %.3f s = %.1f updates/s (wire limit %.1f), lost %u bytes, errors %u\n",
+           (unsigned)loopUs, (unsigned)proto.getFrameCount(), seconds, proto.getFrameCount() / seconds, wireRate,
+           (unsigned)uart.lostBytes, (unsigned)proto.getErrorCount());
+
+    if (uart.lostBytes == 0) {
+        HOST_CHECK_EQ(proto.getFrameCount(), STREAM_FRAMES);
+        HOST_CHECK_EQ(proto.getErrorCount(), 0);
+        HOST_CHECK_NEAR(proto.getFrameCount() / seconds, wireRate, 1.0);
+
+        // 마지막 프레임의 문자열이 표시 중 (같은 문자열을 다시 그려도 바뀌는 그리드 없음)
+        vfd.displayString(text);
+        HOST_CHECK_EQ(vfd.getLastRebuildCount(), 0);
+    }
+
+    hostDetachClock();
+    return uart.lostBytes;
+}
+
+// 프로토콜 마퀴가 끝난 뒤 그 번호를 다시 쓰는 효과를 다음 프로토콜 마퀴가 멈추지 않음
+static void checkMarqueeSlotReuse() {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    MAX6921_SerialProtocol proto(&vfd);
+    proto.setAck(false);
+
+    uint8_t frame[MAX6921_PROTO_MAX_PAYLOAD + 4];
+    // type | first | count | intervalMs | repeat | text : 한 번만 흐르는 마퀴
+    const uint8_t once[] = { MAX6921_EFFECT_MARQUEE, 0, 3, 10, 0, 0, 'H', 'I' };
+    uint32_t length = encodeFrame(MAX6921_CMD_EFFECT, once, sizeof(once), frame);
+    for (uint32_t i = 0; i < length; i++) proto.write(frame[i]);
+    proto.process();
+    HOST_CHECK(!vfd.effects().isIdle());
+
+    hostRunPolling(vfd, 200000UL);
+    HOST_CHECK(vfd.effects().isIdle());
+
+    // 스케치가 시작한 깜박임이 같은 번호를 받음
+    int8_t blink = vfd.effects().blink(5, 2, 100);
+    HOST_CHECK(blink >= 0);
+    HOST_CHECK(vfd.effects().getMarqueeText(blink) == NULL);
+
+    const uint8_t again[] = { MAX6921_EFFECT_MARQUEE, 0, 3, 10, 0, 1, 'A', 'B', 'C' };
+    length = encodeFrame(MAX6921_CMD_EFFECT, again, sizeof(again), frame);
+    for (uint32_t i = 0; i < length; i++) proto.write(frame[i]);
+    proto.process();
+
+    HOST_CHECK(vfd.effects().isActive(blink));
+    HOST_CHECK(vfd.effects().getMarqueeText(blink) == NULL);      // 번호가 여전히 깜박임
+    HOST_CHECK_EQ(proto.getErrorCount(), 0);
+
+    // 프로토콜 마퀴끼리는 이전 것을 멈추고 교체 (슬롯이 늘지 않음)
+    for (uint32_t i = 0; i < length; i++) proto.write(frame[i]);
+    proto.process();
+    uint8_t active = 0;
+    for (int8_t id = 0; id < MAX6921_MAX_EFFECTS; id++) {
+        if (vfd.effects().isActive(id)) active++;
+    }
+    HOST_CHECK_EQ(active, 2);
+
+    hostDetachClock();
+}
+
+int main() {
+    measureLatency(1);
+    measureLatency(1000);
+    measureLatency(5000);
+
+    HOST_CHECK_EQ(measureRate(1), 0);
+    HOST_CHECK_EQ(measureRate(1000), 0);
+    HOST_CHECK_EQ(measureRate(5000), 0);
+    // loop()가 UART 수신 버퍼(64바이트 = 5.6ms)보다 늦으면 바이트를 잃음
+    HOST_CHECK(measureRate(8000) > 0);
+
+    checkMarqueeSlotReuse();
+    return hostTestResult();
+}
@@ -0,0 +1,84 @@
+/*
+ * test_sim_render.cpp
+ *
+ * 가상 체인 + 유리로 폴링 스캔 결과 확인
+ * begin() → displayString() → refresh() 루프 후 셀별 점등 시간이 폰트 패턴과 같은지,
+ * 그리드마다 점등 시간이 같은지(밝기 균일도), 그리드 겹침이 없는지 검사
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "VFD_7BT317NK_Config.h"
+#include "MAX6921_VFD_Driver.h"
+#include "MAX6921_Simulator.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define RUN_FRAMES  10
+#define SLOT_US     DEFAULT_GRID_SCAN_DELAY_US
+#define FRAME_US    ((uint32_t)SLOT_US * VFD_NUM_GRIDS)
+
+int main() {
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS, VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+    hostAttachSim(sim);
+
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    HOST_CHECK_EQ(vfd.getNumGrids(), VFD_NUM_GRIDS);
+
+    const char* text = "1234567";
+    vfd.displayString(text);
+
+    // 첫 화면이 래치되기 전 구간을 빼고 정확히 RUN_FRAMES 화면만 측정
+    hostRunPolling(vfd, FRAME_US);
+    glass.reset();
+    hostRunPolling(vfd, FRAME_US * RUN_FRAMES);
+
+    HOST_CHECK_EQ(glass.getElapsedTime(), FRAME_US * RUN_FRAMES);
+    HOST_CHECK_EQ(glass.getOverlapTime(), 0);
+    HOST_CHECK_EQ(sim.getChain().getShortLatchCount(), 0);
+
+    // 최대 밝기: 슬롯에서 BLANK 예약 구간만 빠짐
+    uint32_t expectedOn = (uint32_t)(SLOT_US - DEFAULT_BLANK_GUARD_US) * RUN_FRAMES;
+    uint32_t tolerance = RUN_FRAMES * 2;
+
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        uint32_t pattern = getCharacterPattern(text[grid]);
+        HOST_CHECK_NEAR(glass.getGridOnTime(grid), expectedOn, tolerance);
+
+        for (uint8_t segment = 0; segment < VFD_NUM_SEGMENTS; segment++) {
+            uint32_t onTime = glass.getSegmentOnTime(grid, segment);
+            if (pattern & (1UL << segment)) {
+                HOST_CHECK_NEAR(onTime, expectedOn, tolerance);
+            } else {
+                HOST_CHECK_EQ(onTime, 0);
+            }
+        }
+    }
+
+    // 내용 변경은 다음 화면 경계부터 반영
+    vfd.displayString("7654321");
+    hostRunPolling(vfd, FRAME_US);
+    glass.reset();
+    hostRunPolling(vfd, FRAME_US * RUN_FRAMES);
+
+    uint32_t lit = 0;
+    for (uint8_t segment = 0; segment < VFD_NUM_SEGMENTS; segment++) {
+        uint32_t onTime = glass.getSegmentOnTime(0, segment);
+        if (getCharacterPattern('7') & (1UL << segment)) {
+            HOST_CHECK_NEAR(onTime, expectedOn, tolerance);
+            lit++;
+        } else {
+            HOST_CHECK_EQ(onTime, 0);
+        }
+    }
+    HOST_CHECK(lit > 0);
+
+    printf("grid on-time %u us / %u frames (slot %u us)\n",
+           (unsigned)glass.getGridOnTime(0), RUN_FRAMES, SLOT_US);
+    return hostTestResult();
+}
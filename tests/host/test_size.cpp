@@ -0,0 +1,47 @@
+/*
+ * test_size.cpp
+ *
+ * 저장소 크기 (MAX6921_GridStore, 드라이버 객체)
+ * - 세그먼트 수 → 가장 작은 저장 형 (컴파일 타임)
+ * - 그리드 데이터: 7BT317NK 7x21 = 28바이트, 현재 용량 8x21 = 32바이트, 이전 uint64_t x 16 = 128바이트
+ * - 드라이버 객체 크기 출력 (호스트는 포인터가 8바이트라 AVR보다 큼, 보드 값은 examples/Benchmark)
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+static_assert(sizeof(MAX6921_SegmentMask<8>::type) == 1, "8 segments fit uint8_t");
+static_assert(sizeof(MAX6921_SegmentMask<9>::type) == 2, "9 segments need uint16_t");
+static_assert(sizeof(MAX6921_SegmentMask<21>::type) == 4, "21 segments fit uint32_t");
+static_assert(sizeof(MAX6921_SegmentMask<33>::type) == 8, "33 segments need uint64_t");
+static_assert(MAX6921_SegmentMask<8>::all == 0xFF, "all bits of uint8_t");
+static_assert(MAX6921_SegmentMask<21>::all == 0x1FFFFFUL, "21 low bits");
+static_assert(MAX6921_SegmentMask<64>::all == ~0ULL, "all bits of uint64_t");
+
+int main() {
+    typedef MAX6921_GridStore<VFD_NUM_GRIDS, VFD_NUM_SEGMENTS> TubeStore;
+    typedef MAX6921_GridStore<16, 64> LegacyStore;
+
+    HOST_CHECK_EQ(sizeof(TubeStore), 7 * 4);
+    HOST_CHECK_EQ(sizeof(VFD_GridStore), VFD_MAX_GRIDS * sizeof(VFD_SegmentMask));
+    HOST_CHECK_EQ(sizeof(LegacyStore), 16 * 8);
+    HOST_CHECK_EQ(sizeof(MAX6921_FrameBuffer), VFD_MAX_GRIDS * VFD_MAX_FRAME_BYTES);
+
+    // 세그먼트 연산은 저장 형 안에서 (용량 밖 비트는 잘림)
+    VFD_GridStore store;
+    store.set(2, (VFD_SegmentMask)0xFFFFFFFFUL);
+    HOST_CHECK_EQ(store.get(2), VFD_GridStore::allSegments);
+
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    printf("grid store: tube %ux%u = %u B, capacity %ux%u = %u B, legacy 16x64 = %u B\n",
+           VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, (unsigned)sizeof(TubeStore),
+           VFD_MAX_GRIDS, VFD_MAX_SEGMENTS, (unsigned)sizeof(VFD_GridStore), (unsigned)sizeof(LegacyStore));
+    printf("frame buffer %u B x 3, driver object %u B (host, %u-byte pointers)\n",
+           (unsigned)sizeof(MAX6921_FrameBuffer), (unsigned)sizeof(vfd), (unsigned)sizeof(void*));
+
+    return hostTestResult();
+}
@@ -0,0 +1,198 @@
+/*
+ * test_tear.cpp
+ *
+ * 페이지 플립 찢김 스트레스 (foreground 그리기 vs 스캔 ISR)
+ * 호스트는 단일 스레드이므로 그리기 함수 호출 사이마다 ISR(advanceScan() + 래치)을 0-2화면 분량 임의로
+ * 끼워 넣고, 스캔한 모든 완성 화면(슬롯 0-6)이 present()된 한 화면과 같은지 검사
+ * - displayString() (자동 present), clear() + 자리별 displayCharacter() + present(), setFrame()
+ * - 화면은 세대 순서대로만 바뀌고(되돌아가지 않음) 그리드 0 경계에서만 바뀜
+ * - 민감도 확인: 자동 present를 켠 채 clear() + 자리별 쓰기를 하면 반쯤 그린 화면이 실제로 잡힘
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define GENERATIONS     3000
+#define NO_GENERATION   0xFFFF
+
+static uint32_t lcgState = 2025;
+
+static uint32_t nextRandom(uint32_t range) {
+    lcgState = lcgState * 1103515245UL + 12345UL;
+    return (lcgState >> 16) % range;
+}
+
+// 세대 g의 문자열: 자리마다 다른 숫자, 세대마다 모든 자리가 바뀜 (10세대 주기)
+static char generationChar(uint16_t generation, uint8_t grid) {
+    return (char)('0' + (generation + grid * 3) % 10);
+}
+
+static uint32_t chainWord(const MAX6921_SimChain& chain, uint8_t chip) {
+    uint32_t word = 0;
+    for (uint8_t bit = 0; bit < MAX6921_OUTPUT_BITS; bit++) {
+        if (chain.getLatch(chip * MAX6921_OUTPUT_BITS + bit)) word |= 1UL << bit;
+    }
+    return word;
+}
+
+// 스캔 쪽 검사: 슬롯마다 래치된 그리드/세그먼트를 모아 화면 단위로 세대 판정
+class TearChecker {
+private:
+    MAX6921_VFD_Driver& _vfd;
+    MAX6921_SimTransport& _sim;
+    uint32_t _segments[VFD_NUM_GRIDS];
+    uint8_t _slot;
+    bool _synced;                         // 첫 그리드 0부터 모음
+
+public:
+    uint16_t lastGeneration;
+    uint32_t frames;
+    uint32_t tornFrames;
+    uint32_t backwardFrames;
+    uint32_t gridOrderErrors;
+
+    TearChecker(MAX6921_VFD_Driver& vfd, MAX6921_SimTransport& sim)
+        : _vfd(vfd), _sim(sim), _slot(0), _synced(false), lastGeneration(NO_GENERATION),
+          frames(0), tornFrames(0), backwardFrames(0), gridOrderErrors(0) {}
+
+    // 스캔 ISR 한 번 (다음 그리드 프레임 래치)
+    void isr() {
+        _sim.send(_vfd.advanceScan(), _vfd.getFrameBytes());
+
+        uint32_t data1 = chainWord(_sim.getChain(), 0);
+        uint32_t data2 = chainWord(_sim.getChain(), 1);
+        uint32_t gridBits = data1 & ((1UL << VFD_NUM_GRIDS) - 1);
+        uint8_t grid = 0;
+        while (grid < VFD_NUM_GRIDS && gridBits != (1UL << grid)) grid++;
+
+        if (!_synced) {
+            if (grid != 0) return;
+            _synced = true;
+            _slot = 0;
+        }
+        if (grid != _slot) {
+            gridOrderErrors++;
+            _slot = 0;
+            _synced = false;
+            return;
+        }
+        _segments[grid] = ((data1 >> 7) & 0x1FFF) | (data2 << 13);
+
+        if (++_slot == VFD_NUM_GRIDS) {
+            _slot = 0;
+            checkFrame();
+        }
+    }
+
+    void run(uint32_t slots) {
+        for (uint32_t i = 0; i < slots; i++) isr();
+    }
+
+private:
+    // 모든 그리드가 같은 세대 문자열이어야 함 (빈 화면 = begin() 직후)
+    void checkFrame() {
+        frames++;
+        uint16_t match = NO_GENERATION;
+        for (uint16_t g = 0; g < 10 && match == NO_GENERATION; g++) {
+            bool same = true;
+            for (uint8_t grid = 0; grid < VFD_NUM_GRIDS && same; grid++) {
+                same = (_segments[grid] == getCharacterPattern(generationChar(g, grid)));
+            }
+            if (same) match = g;
+        }
+
+        bool blank = true;
+        for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+            if (_segments[grid] != 0) blank = false;
+        }
+
+        if (match == NO_GENERATION) {
+            if (!blank || lastGeneration != NO_GENERATION) tornFrames++;
+            return;
+        }
+        // 10세대 주기 안에서 앞으로만 진행
+        if (lastGeneration != NO_GENERATION && match != lastGeneration &&
+            (match + 10 - lastGeneration) % 10 > 5) {
+            backwardFrames++;
+        }
+        lastGeneration = match;
+    }
+};
+
+static void drawGeneration(MAX6921_VFD_Driver& vfd, TearChecker& isr, uint16_t generation, uint8_t method) {
+    char text[VFD_NUM_GRIDS + 1];
+    VFD_SegmentMask masks[VFD_NUM_GRIDS];
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        text[grid] = generationChar(generation, grid);
+        masks[grid] = (VFD_SegmentMask)getCharacterPattern(text[grid]);
+    }
+    text[VFD_NUM_GRIDS] = '\0';
+
+    switch (method) {
+    case 0:
+        vfd.displayString(text);
+        break;
+    case 1:
+        vfd.setAutoPresent(false);
+        vfd.clear();
+        isr.run(nextRandom(VFD_NUM_GRIDS * 2));
+        for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+            vfd.displayCharacter(grid, text[grid]);
+            isr.run(nextRandom(VFD_NUM_GRIDS * 2));
+        }
+        vfd.present();
+        vfd.setAutoPresent(true);
+        break;
+    default:
+        vfd.setFrame(masks);
+        break;
+    }
+    isr.run(nextRandom(VFD_NUM_GRIDS * 2));
+}
+
+int main() {
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+
+    TearChecker isr(vfd, sim);
+    isr.run(VFD_NUM_GRIDS * 2);
+
+    for (uint16_t generation = 0; generation < GENERATIONS; generation++) {
+        drawGeneration(vfd, isr, generation, (uint8_t)nextRandom(3));
+    }
+    // 마지막 화면이 표시될 때까지
+    isr.run(VFD_NUM_GRIDS * 2);
+
+    printf("page flip: %u frames scanned, %u torn, %u backward\n",
+           (unsigned)isr.frames, (unsigned)isr.tornFrames, (unsigned)isr.backwardFrames);
+    HOST_CHECK(isr.frames > GENERATIONS / 2);
+    HOST_CHECK_EQ(isr.tornFrames, 0);
+    HOST_CHECK_EQ(isr.backwardFrames, 0);
+    HOST_CHECK_EQ(isr.gridOrderErrors, 0);
+    HOST_CHECK_EQ(isr.lastGeneration, (GENERATIONS - 1) % 10);
+    HOST_CHECK(!vfd.isFlipPending());
+
+    // 민감도: 자동 present를 켠 채 자리마다 그리면 반쯤 그린 화면이 보임
+    TearChecker naive(vfd, sim);
+    for (uint16_t generation = 0; generation < 200; generation++) {
+        vfd.clear();
+        naive.run(nextRandom(VFD_NUM_GRIDS * 2));
+        for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+            vfd.displayCharacter(grid, generationChar(generation, grid));
+            naive.run(nextRandom(VFD_NUM_GRIDS * 2));
+        }
+    }
+    printf("per-cell present: %u frames scanned, %u torn\n", (unsigned)naive.frames, (unsigned)naive.tornFrames);
+    HOST_CHECK(naive.tornFrames > 0);
+
+    hostDetachClock();
+    return hostTestResult();
+}
@@ -0,0 +1,144 @@
+/*
+ * test_text_layout.cpp
+ *
+ * '.'/':' 접기 (max6921LayoutText)
+ * - 앞 자리에 합침, 맨 앞, 반복, 줄 끝(자리가 다 찬 뒤), 공백 뒤, 자리 넘침
+ * - 앞 자리 그리드에 애넌시에이터가 없으면 자기 자리 (있으면 빈 칸 + 표시, 없으면 폰트 문자)
+ * - displayString()으로 표시했을 때 유리에 문자 패턴 + 소수점/콜론 세그먼트
+ * - displayString() 뒤 setSegment()로 끈 소수점을 setColon()/setDecimalPoint()가 다시 켜지 않음
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_7BT317NK_Font.h"
+#include "host_test.h"
+
+#define ALL_GRIDS   0x7F
+
+// 자리 배치를 "[1][2:][3.]" 형태 문자열로
+static void formatCells(const MAX6921_TextCell* cells, uint8_t count, char* out) {
+    for (uint8_t i = 0; i < count; i++) {
+        *out++ = '[';
+        *out++ = cells[i].character;
+        if (cells[i].marks & MAX6921_MARK_DP) *out++ = '.';
+        if (cells[i].marks & MAX6921_MARK_COLON) *out++ = ':';
+        *out++ = ']';
+    }
+    *out = '\0';
+}
+
+static void checkLayout(const char* text, uint16_t dpGrids, uint16_t colonGrids,
+                        const char* expected, uint8_t expectedUsed) {
+    MAX6921_TextCell cells[VFD_NUM_GRIDS];
+    char actual[VFD_NUM_GRIDS * 5 + 1];
+    uint8_t used = max6921LayoutText(text, cells, VFD_NUM_GRIDS, dpGrids, colonGrids);
+    formatCells(cells, VFD_NUM_GRIDS, actual);
+
+    hostChecks++;
+    if (strcmp(actual, expected) != 0 || used != expectedUsed) {
+        hostFailures++;
+        printf("FAIL \"%s\": %s used %u (expected %s used %u)\n", text, actual, used, expected, expectedUsed);
+    }
+}
+
+// 두 화면 스캔 후 그리드의 세그먼트 점등 여부
+static bool segmentLit(MAX6921_VFD_Driver& vfd, VFD_SimGlass& glass, uint8_t grid, uint8_t segment) {
+    uint32_t frameUs = (uint32_t)DEFAULT_GRID_SCAN_DELAY_US * VFD_NUM_GRIDS;
+    hostRunPolling(vfd, frameUs);
+    glass.reset();
+    hostRunPolling(vfd, frameUs);
+    return glass.getSegmentOnTime(grid, segment) > 0;
+}
+
+int main() {
+    // 앞 자리에 합침
+    checkLayout("12:34.5",  ALL_GRIDS, ALL_GRIDS, "[1][2:][3][4.][5][ ][ ]", 5);
+    checkLayout("1.:2",     ALL_GRIDS, ALL_GRIDS, "[1.:][2][ ][ ][ ][ ][ ]", 2);
+    checkLayout("12:.3",    ALL_GRIDS, ALL_GRIDS, "[1][2.:][3][ ][ ][ ][ ]", 3);
+
+    // 맨 앞: 앞 자리가 없으므로 빈 칸 + 표시
+    checkLayout(".5",       ALL_GRIDS, ALL_GRIDS, "[ .][5][ ][ ][ ][ ][ ]", 2);
+    checkLayout(":30",      ALL_GRIDS, ALL_GRIDS, "[ :][3][0][ ][ ][ ][ ]", 3);
+
+    // 반복: 앞 자리에 같은 표시가 이미 있으면 자기 자리
+    checkLayout("1..2",     ALL_GRIDS, ALL_GRIDS, "[1.][ .][2][ ][ ][ ][ ]", 3);
+    checkLayout("1::2",     ALL_GRIDS, ALL_GRIDS, "[1:][ :][2][ ][ ][ ][ ]", 3);
+    checkLayout(".........", ALL_GRIDS, ALL_GRIDS, "[ .][ .][ .][ .][ .][ .][ .]", 7);
+
+    // 줄 끝: 자리가 다 찬 뒤에도 마지막 자리에 합칠 수 있으면 합침
+    checkLayout("1234567.", ALL_GRIDS, ALL_GRIDS, "[1][2][3][4][5][6][7.]", 7);
+    checkLayout("1234567.:", ALL_GRIDS, ALL_GRIDS, "[1][2][3][4][5][6][7.:]", 7);
+    checkLayout("1234567..", ALL_GRIDS, ALL_GRIDS, "[1][2][3][4][5][6][7.]", 7);
+
+    // 공백 뒤: 공백 자리에 합침
+    checkLayout("1 .2",     ALL_GRIDS, ALL_GRIDS, "[1][ .][2][ ][ ][ ][ ]", 3);
+    checkLayout(" :3",      ALL_GRIDS, ALL_GRIDS, "[ :][3][ ][ ][ ][ ][ ]", 2);
+    checkLayout("1 . 2",    ALL_GRIDS, ALL_GRIDS, "[1][ .][ ][2][ ][ ][ ]", 4);
+
+    // 넘침: 남는 문자는 버림
+    checkLayout("12345678.9", ALL_GRIDS, ALL_GRIDS, "[1][2][3][4][5][6][7]", 7);
+    checkLayout("1.2.3.4.5.6.7.8.9", ALL_GRIDS, ALL_GRIDS, "[1.][2.][3.][4.][5.][6.][7.]", 7);
+
+    // 애넌시에이터가 없는 그리드
+    checkLayout("3.14",     0x01, 0,          "[3.][1][4][ ][ ][ ][ ]", 3);
+    checkLayout("3.14",     0, 0,             "[3][.][1][4][ ][ ][ ]", 4);
+    checkLayout("A.B",      0x7E, ALL_GRIDS,  "[A][ .][B][ ][ ][ ][ ]", 3);
+    checkLayout("",         ALL_GRIDS, ALL_GRIDS, "[ ][ ][ ][ ][ ][ ][ ]", 0);
+
+    // 표시: 문자 패턴 + P20(소수점/콜론)
+    VFD_SimGlass glass(VFD_GRID_CHAIN_BIT, VFD_NUM_GRIDS, VFD_SEGMENT_CHAIN_BIT, VFD_NUM_SEGMENTS);
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS, &glass);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString(".1..2:");
+
+    uint32_t frameUs = (uint32_t)DEFAULT_GRID_SCAN_DELAY_US * VFD_NUM_GRIDS;
+    hostRunPolling(vfd, frameUs);
+    glass.reset();
+    hostRunPolling(vfd, frameUs);
+
+    const char expectedChars[VFD_NUM_GRIDS] = { ' ', '1', ' ', '2', ' ', ' ', ' ' };
+    const bool expectedMark[VFD_NUM_GRIDS] = { true, true, true, true, false, false, false };
+    for (uint8_t grid = 0; grid < VFD_NUM_GRIDS; grid++) {
+        uint32_t pattern = getCharacterPattern(expectedChars[grid]);
+        if (expectedMark[grid]) pattern |= 1UL << VFD_DP_SEGMENT;
+        for (uint8_t segment = 0; segment < VFD_NUM_SEGMENTS; segment++) {
+            bool lit = glass.getSegmentOnTime(grid, segment) > 0;
+            HOST_CHECK_EQ(lit, (pattern & (1UL << segment)) != 0);
+        }
+    }
+
+    // setSegment() 뒤 구두점 표시 = 실제 P20 상태 (P20은 소수점과 콜론이 공유)
+    vfd.displayString("12.34");
+    HOST_CHECK(segmentLit(vfd, glass, 1, VFD_DP_SEGMENT));
+    vfd.setSegment(1, VFD_DP_SEGMENT, false);
+    HOST_CHECK(!segmentLit(vfd, glass, 1, VFD_DP_SEGMENT));
+    vfd.setColon(1, false);                       // 남은 소수점 표시가 있으면 P20이 다시 켜짐
+    HOST_CHECK(!segmentLit(vfd, glass, 1, VFD_DP_SEGMENT));
+    vfd.setDecimalPoint(0, true);                 // 다른 자리 변경도 영향 없음
+    HOST_CHECK(!segmentLit(vfd, glass, 1, VFD_DP_SEGMENT));
+    HOST_CHECK(segmentLit(vfd, glass, 0, VFD_DP_SEGMENT));
+
+    // 직접 켠 P20은 소수점+콜론 표시로 취급되어 setDecimalPoint()/setColon()으로 끌 수 있음
+    vfd.setSegment(2, VFD_DP_SEGMENT, true);
+    HOST_CHECK(segmentLit(vfd, glass, 2, VFD_DP_SEGMENT));
+    vfd.setDecimalPoint(2, false);
+    HOST_CHECK(segmentLit(vfd, glass, 2, VFD_DP_SEGMENT));     // 콜론 표시가 P20을 유지
+    vfd.setColon(2, false);
+    HOST_CHECK(!segmentLit(vfd, glass, 2, VFD_DP_SEGMENT));
+    HOST_CHECK(segmentLit(vfd, glass, 2, 0) == ((getCharacterPattern('3') & 1) != 0));
+
+    // 다시 displayString()하면 문자와 소수점을 새로 그림
+    vfd.displayString("12.34");
+    HOST_CHECK(segmentLit(vfd, glass, 1, VFD_DP_SEGMENT));
+    HOST_CHECK(!segmentLit(vfd, glass, 0, VFD_DP_SEGMENT));
+
+    hostDetachClock();
+    return hostTestResult();
+}
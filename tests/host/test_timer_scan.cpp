@@ -0,0 +1,200 @@
+/*
+ * test_timer_scan.cpp
+ *
+ * 타이머 ISR 스캔 (Timer1 모델 + 하드웨어 SPI 전송 shim)
+ * - ISR 주기: 그리드 주기와 정확히 같고, loop()가 블로킹해도 유지
+ * - 인터럽트 금지 구간만큼만 지연 (지터 상한)
+ * - ISR 1회 최대 소요 시간: 프레임 전송(SPI 클록) + lead 가드(상한 MAX6921_TIMER_MAX_LEAD_US), BLANK 예약 구간 안
+ * - BLANK 해제(COMPB)까지 포함한 표시 시간 = 슬롯 - 예약
+ * - 인터럽트 보호 구간은 들어갈 때 상태를 복원: ISR 안의 페이드 진행(updateFade → updateBlankTiming)이
+ *   인터럽트를 켜지 않고, 사용자의 noInterrupts() 구간 안에서 부른 설정 함수도 인터럽트를 켜지 않음
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include "MAX6921_VFD_Driver.h"
+#include "host_test.h"
+
+#define LOAD_PIN    8
+#define BLANK_PIN   7                     // 타이머 출력이 아닌 핀: 소프트웨어 BLANK (COMPB ISR)
+#define PWM_PIN     9                     // OC1A: 하드웨어 PWM BLANK
+#define PERIOD_US   2000
+
+// BLANK 핀 LOW(표시) 시간 누적
+struct BlankMonitor {
+    uint8_t pin;
+    uint32_t lowSince;
+    uint32_t lowTime;
+    uint32_t releases;
+};
+
+static void onPin(void* context, uint8_t pin, uint8_t level) {
+    BlankMonitor* monitor = static_cast<BlankMonitor*>(context);
+    if (pin != monitor->pin) return;
+    if (level == LOW) {
+        monitor->lowSince = micros();
+        monitor->releases++;
+    } else if (monitor->lowSince != 0) {
+        monitor->lowTime += micros() - monitor->lowSince;
+        monitor->lowSince = 0;
+    }
+}
+
+static void runSoftwareBlank() {
+    printf("-- software BLANK (pin %u)\n", BLANK_PIN);
+    hostResetTimer1();
+    BlankMonitor monitor = { BLANK_PIN, 0, 0, 0 };
+    hostAttachPinListener(onPin, &monitor);
+
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("1234567");
+    HOST_CHECK(vfd.beginTimerScan(PERIOD_US));
+    HOST_CHECK(vfd.isTimerScanActive());
+
+    // 1) loop()가 아무것도 안 할 때: 주기 정확히 일정
+    hostAdvance(PERIOD_US * 3);
+    hostResetIsrStats();
+    monitor.lowTime = 0;
+    monitor.releases = 0;
+    SPI.clearLog();
+    hostAdvance(PERIOD_US * 70);
+
+    const HostIsrStats& ovf = hostGetOverflowStats();
+    HOST_CHECK_EQ(ovf.count, 70);
+    HOST_CHECK_EQ(ovf.minIntervalUs, PERIOD_US);
+    HOST_CHECK_EQ(ovf.maxIntervalUs, PERIOD_US);
+    HOST_CHECK_EQ(SPI.getByteCount(), 70 * vfd.getFrameBytes());
+    HOST_CHECK_NEAR(hostGetCompareBStats().count, 70, 1);   // 측정 구간 경계의 슬롯
+    HOST_CHECK_NEAR(monitor.releases, 70, 1);
+
+    // 최대 밝기 표시 시간 = 슬롯 - BLANK 예약 (ISR 진입 지연 없음)
+    HOST_CHECK_NEAR(monitor.lowTime, 70.0 * (PERIOD_US - DEFAULT_BLANK_GUARD_US), 70);
+
+    // ISR 1회 시간: 5바이트 @ 4MHz = 10us, 드라이버 측정값과 일치하고 예약 구간 안
+    uint32_t transferUs = (uint32_t)vfd.getFrameBytes() * 8 * 1000000UL / DEFAULT_SPI_CLOCK_SPEED;
+    HOST_CHECK_EQ(ovf.maxDurationUs, transferUs);
+    HOST_CHECK_EQ(vfd.getMaxScanTimeUs(), transferUs);
+    HOST_CHECK(ovf.maxDurationUs < DEFAULT_BLANK_GUARD_US);
+    printf("isr period %u-%u us, worst isr %u us (host %u ns), missed %u\n",
+           (unsigned)ovf.minIntervalUs, (unsigned)ovf.maxIntervalUs, (unsigned)ovf.maxDurationUs,
+           (unsigned)ovf.maxHostNs, (unsigned)vfd.getMissedDeadlineCount());
+    HOST_CHECK_EQ(vfd.getMissedDeadlineCount(), 0);
+
+    // 2) loop()가 delay(100)으로 블로킹해도 스캔은 계속
+    hostResetIsrStats();
+    delay(100);
+    HOST_CHECK_EQ(hostGetOverflowStats().count, 100000 / PERIOD_US);
+    HOST_CHECK_EQ(hostGetOverflowStats().maxIntervalUs, PERIOD_US);
+
+    // 3) 인터럽트 금지 구간 (예: 다른 라이브러리의 30us 임계 구역)
+    //    ISR은 그만큼 늦어지지만 다음 ISR은 원래 주기로 돌아옴 (누적 없음)
+    hostResetIsrStats();
+    for (int i = 0; i < 50; i++) {
+        hostAdvance(PERIOD_US - 37 + (i % 7) * 11);
+        noInterrupts();
+        hostAdvance(30);
+        interrupts();
+    }
+    const HostIsrStats& jitter = hostGetOverflowStats();
+    printf("with 30us critical sections: isr period %u-%u us\n",
+           (unsigned)jitter.minIntervalUs, (unsigned)jitter.maxIntervalUs);
+    HOST_CHECK(jitter.maxIntervalUs <= PERIOD_US + 30);
+    HOST_CHECK(jitter.minIntervalUs >= PERIOD_US - 30);
+
+    // 4) lead 가드는 ISR 안의 대기로 더해짐
+    vfd.setBlankGuard(10, 0);
+    hostAdvance(PERIOD_US * 2);
+    vfd.resetScanStats();
+    hostAdvance(PERIOD_US * 14);
+    HOST_CHECK_EQ(vfd.getMaxScanTimeUs(), transferUs + 10);
+
+    // ISR 안의 lead 대기는 MAX6921_TIMER_MAX_LEAD_US로 제한 (다른 인터럽트를 오래 막지 않음)
+    vfd.setBlankGuard(500, 0);
+    hostAdvance(PERIOD_US * 2);
+    vfd.resetScanStats();
+    hostResetIsrStats();
+    hostAdvance(PERIOD_US * 14);
+    HOST_CHECK_EQ(vfd.getMaxScanTimeUs(), transferUs + MAX6921_TIMER_MAX_LEAD_US);
+    HOST_CHECK_EQ(hostGetOverflowStats().maxDurationUs, transferUs + MAX6921_TIMER_MAX_LEAD_US);
+    HOST_CHECK_EQ(vfd.getMissedDeadlineCount(), 0);
+
+    vfd.endTimerScan();
+    HOST_CHECK(!vfd.isTimerScanActive());
+    hostResetIsrStats();
+    hostAdvance(PERIOD_US * 5);
+    HOST_CHECK_EQ(hostGetOverflowStats().count, 0);
+    hostAttachPinListener(NULL, NULL);
+}
+
+static void runHardwareBlank() {
+    printf("-- hardware PWM BLANK (OC1A, pin %u)\n", PWM_PIN);
+    hostResetTimer1();
+    BlankMonitor monitor = { PWM_PIN, 0, 0, 0 };
+    hostAttachPinListener(onPin, &monitor);
+
+    MAX6921_VFD_Driver vfd(LOAD_PIN, PWM_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("1234567");
+    vfd.setBrightness(VFD_MAX_BRIGHTNESS / 2);
+    HOST_CHECK(vfd.beginTimerScan(PERIOD_US));
+
+    hostAdvance(PERIOD_US * 3);
+    hostResetIsrStats();
+    monitor.lowTime = 0;
+    monitor.releases = 0;
+    hostAdvance(PERIOD_US * 70);
+
+    // COMPB ISR 없이 하드웨어가 BLANK를 해제
+    HOST_CHECK_EQ(hostGetOverflowStats().count, 70);
+    HOST_CHECK_EQ(hostGetCompareBStats().count, 0);
+    HOST_CHECK_NEAR(monitor.releases, 70, 1);
+
+    uint32_t usable = PERIOD_US - DEFAULT_BLANK_GUARD_US;
+    uint32_t onUs = ((uint32_t)usable * max6921BrightnessToDuty(VFD_MAX_BRIGHTNESS / 2, VFD_MAX_BRIGHTNESS)) >> 16;
+    HOST_CHECK_NEAR(monitor.lowTime, 70.0 * onUs, 70);
+    printf("brightness %u: on %u us per slot (expected %u)\n",
+           VFD_MAX_BRIGHTNESS / 2, (unsigned)(monitor.lowTime / 70), (unsigned)onUs);
+
+    vfd.endTimerScan();
+    hostAttachPinListener(NULL, NULL);
+}
+
+// 보호 구간 중첩: ISR/사용자 임계 구역 안에서 인터럽트를 다시 켜지 않음
+static void runAtomicState() {
+    printf("-- interrupt state in critical sections\n");
+    hostResetTimer1();
+    MAX6921_VFD_Driver vfd(LOAD_PIN, BLANK_PIN, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    HOST_CHECK(vfd.begin());
+    vfd.displayString("1234567");
+    HOST_CHECK(vfd.beginTimerScan(PERIOD_US));
+
+    // 페이드는 ISR의 화면 경계에서 진행 (표시 시간 테이블을 보호 구간에서 갱신)
+    uint32_t enables = hostGetIsrInterruptEnableCount();
+    vfd.fadeTo(VFD_MAX_BRIGHTNESS / 4, 200);
+    hostAdvance(300000UL);
+    HOST_CHECK(!vfd.isFading());
+    HOST_CHECK_EQ(vfd.getBrightness(), VFD_MAX_BRIGHTNESS / 4);
+    HOST_CHECK_EQ(hostGetIsrInterruptEnableCount() - enables, 0);
+
+    // 사용자 임계 구역 안의 설정 변경
+    noInterrupts();
+    vfd.setBrightness(VFD_MAX_BRIGHTNESS / 2);
+    vfd.setScanOrder(MAX6921_SCAN_INTERLEAVED);
+    vfd.setBlankGuard(5, 5);
+    HOST_CHECK(!hostInterruptsEnabled());
+    interrupts();
+    HOST_CHECK(hostInterruptsEnabled());
+
+    printf("ISR interrupt re-enables during fade: %u\n", (unsigned)(hostGetIsrInterruptEnableCount() - enables));
+    vfd.endTimerScan();
+}
+
+int main() {
+    runSoftwareBlank();
+    runHardwareBlank();
+    runAtomicState();
+    return hostTestResult();
+}
@@ -0,0 +1,141 @@
+/*
+ * test_tube_profiles.cpp
+ *
+ * 같은 문자열을 두 튜브 프로필(7BT317NK, HL-D812D)로 표시
+ * - 체인으로 나간 그리드별 프레임 = 프로필 출력 맵(gridFrame + 세그먼트 마스크)으로 만든 기대 프레임
+ * - 가상 유리의 셀 점등 = 프로필 폰트 패턴
+ * - 용량(VFD_MAX_GRIDS)보다 큰 프로필과 없는 이름은 거부
+ *
+ * Author: Your Name
+ * Date: August 2025
+ * Version: 1.0
+ */
+
+#include <string.h>
+#include "MAX6921_VFD_Driver.h"
+#include "VFD_HLD812D_Profile.h"
+#include "host_test.h"
+
+#define SLOT_US     DEFAULT_GRID_SCAN_DELAY_US
+
+const MAX6921_TubeProfile* const PROFILES[] PROGMEM = { &VFD_7BT317NK_PROFILE, &VFD_HLD812D_PROFILE };
+
+// 보낸 프레임을 기록하는 시뮬레이터 전송 계층
+class RecordingTransport : public MAX6921_SimTransport {
+public:
+    uint8_t frames[64][VFD_MAX_FRAME_BYTES];
+    uint8_t count;
+
+    RecordingTransport(uint8_t numChips, VFD_SimGlass* glass)
+        : MAX6921_SimTransport(numChips, glass), count(0) {}
+
+    virtual void send(const uint8_t* frame, uint8_t length) {
+        if (count < 64) {
+            memcpy(frames[count++], frame, length);
+        }
+        MAX6921_SimTransport::send(frame, length);
+    }
+};
+
+// 프로필 출력 맵으로 그리드 g에 패턴을 표시하는 프레임 생성
+static void buildExpectedFrame(const MAX6921_TubeProfile& tube, uint8_t grid, uint32_t pattern, uint8_t* out) {
+    memcpy_P(out, tube.gridFrame + (uint16_t)grid * tube.frameBytes, tube.frameBytes);
+    for (uint8_t segment = 0; segment < tube.numSegments; segment++) {
+        if (pattern & (1UL << segment)) {
+            out[pgm_read_byte(&tube.segmentFrameByte[segment])] |= pgm_read_byte(&tube.segmentFrameMask[segment]);
+        }
+    }
+}
+
+// 프레임에 켜진 그리드 선택 비트로 그리드 번호 찾기
+static int findGrid(const MAX6921_TubeProfile& tube, const uint8_t* frame) {
+    for (uint8_t grid = 0; grid < tube.numGrids; grid++) {
+        const uint8_t* select = tube.gridFrame + (uint16_t)grid * tube.frameBytes;
+        bool match = true;
+        bool any = false;
+        for (uint8_t b = 0; b < tube.frameBytes; b++) {
+            uint8_t bits = pgm_read_byte(&select[b]);
+            if (bits) any = true;
+            if ((frame[b] & bits) != bits) match = false;
+        }
+        if (any && match) return grid;
+    }
+    return -1;
+}
+
+static void renderOnProfile(const char* name, const char* text) {
+    const MAX6921_TubeProfile* profile = max6921FindTubeProfile(PROFILES, 2, name);
+    HOST_CHECK(profile != NULL);
+    if (profile == NULL) return;
+
+    MAX6921_TubeProfile tube;
+    max6921LoadTubeProfile(profile, &tube);
+    printf("-- %s: %u grids, %u segments, %u chips, '%s'\n",
+           name, tube.numGrids, tube.numSegments, tube.numChips, text);
+
+    VFD_SimGlass glass(tube.gridChainBit, tube.numGrids, tube.segmentChainBit, tube.numSegments);
+    RecordingTransport sim(tube.numChips, &glass);
+    hostAttachSim(sim);
+
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin(profile));
+    HOST_CHECK_EQ(vfd.getNumGrids(), tube.numGrids);
+    HOST_CHECK_EQ(vfd.getFrameBytes(), tube.frameBytes);
+    vfd.displayString(text);
+
+    uint32_t frameUs = (uint32_t)SLOT_US * tube.numGrids;
+    hostRunPolling(vfd, frameUs);
+    glass.reset();
+    sim.count = 0;
+    hostRunPolling(vfd, frameUs);
+
+    // 체인 스트림: 한 화면 동안 그리드마다 한 번, 기대 프레임과 비트 단위로 같음
+    HOST_CHECK_EQ(sim.count, tube.numGrids);
+    uint16_t seen = 0;
+    size_t length = strlen(text);
+    for (uint8_t i = 0; i < sim.count; i++) {
+        int grid = findGrid(tube, sim.frames[i]);
+        HOST_CHECK(grid >= 0);
+        if (grid < 0) continue;
+        seen |= (uint16_t)(1U << grid);
+
+        char c = ((size_t)grid < length) ? text[grid] : ' ';
+        uint32_t pattern = max6921ReadPattern(tube.font, (uint8_t)(c - 0x20));
+        uint8_t expected[VFD_MAX_FRAME_BYTES];
+        buildExpectedFrame(tube, (uint8_t)grid, pattern, expected);
+        HOST_CHECK(memcmp(sim.frames[i], expected, tube.frameBytes) == 0);
+
+        // 유리: 패턴 비트만 점등
+        for (uint8_t segment = 0; segment < tube.numSegments; segment++) {
+            bool lit = glass.getSegmentOnTime((uint8_t)grid, segment) > 0;
+            HOST_CHECK_EQ(lit, (pattern & (1UL << segment)) != 0);
+        }
+    }
+    HOST_CHECK_EQ(seen, (1U << tube.numGrids) - 1);
+    HOST_CHECK_EQ(glass.getOverlapTime(), 0);
+    HOST_CHECK_EQ(sim.getChain().getShortLatchCount(), 0);
+}
+
+int main() {
+    renderOnProfile("7BT317NK", "HELLO12");
+    renderOnProfile("HLD812D", "HELLO12");
+
+    // 없는 이름
+    HOST_CHECK(max6921FindTubeProfile(PROFILES, 2, "NOPE") == NULL);
+
+    // 저장소 용량보다 큰 프로필은 거부하고 기존 프로필 유지 (호스트에서는 PROGMEM = RAM)
+    MAX6921_TubeProfile big;
+    memcpy_P(&big, &VFD_HLD812D_PROFILE, sizeof(big));
+    big.numGrids = VFD_MAX_GRIDS + 1;
+    MAX6921_SimTransport sim(VFD_REQUIRED_CHIPS);
+    hostAttachSim(sim);
+    MAX6921_VFD_Driver vfd(10, 9, VFD_NUM_GRIDS, VFD_NUM_SEGMENTS, VFD_MAX_BRIGHTNESS);
+    vfd.setTransport(&sim);
+    HOST_CHECK(vfd.begin());
+    HOST_CHECK(!vfd.setTubeProfile(&big));
+    HOST_CHECK_EQ(vfd.getNumGrids(), VFD_NUM_GRIDS);
+
+    hostDetachClock();
+    return hostTestResult();
+}
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""
+gen_font_table.py
+
+VFD 폰트 맵(font-table.md)으로부터 드라이버용 패킹 폰트 테이블(.cpp)을 생성합니다.
+
+    python3 tools/gen_font_table.py vfd-configs/font-maps/7BT317NK/font-table.md \
+        --connection vfd-configs/connection-tables/7BT317NK.json \
+        -o arduino/VFD_7BT317NK_Font/VFD_7BT317NK_FontTable.cpp
+
+출력 파일은 VFD_<모델>_Font.h에 선언된 세 테이블을 정의합니다 (모두 PROGMEM).
+
+    VFD_<모델>_FONT_DENSE      문자 코드 0x20-0x7F → 패턴 (패턴당 3바이트, MAX6921_PACK_PATTERN)
+    VFD_<모델>_FONT_DIGITS     숫자 0-9 → 패턴
+    VFD_<모델>_FONT_SUPPORTED  문자 코드 0x20-0x7F → 지원 여부 (1비트/문자)
+
+표에 소문자 행이 없으면 소문자는 대문자 패턴으로 접어서 저장하고, 표에 없는 문자는 0(공백)입니다.
+
+--check 옵션을 주면 파일을 쓰지 않고, 기존 파일이 표에서 새로 생성한 결과와 같은지만
+확인합니다 (다르면 diff 출력 후 종료 코드 1). 표를 수정한 뒤 테이블을 다시 생성하지 않았거나
+테이블을 손으로 고친 경우를 업로드 전에 잡기 위한 용도입니다.
+
+--report 옵션은 검증 보고서(지원 문자, 세그먼트별 사용 횟수, 같은 패턴을 가진 문자)를 출력합니다.
+같은 패턴을 가진 글자/숫자(예: 전사 실수로 'I'가 'D'와 같아진 경우)와 어떤 문자도 켜지 않는
+세그먼트는 --report가 없어도 경고로 출력됩니다.
+
+표 형식은 vfd-configs/font-maps/7BT317NK/font-table.md 참조
+(|문자|P0|P1|...| 머리글 행, 문자 열의 "공백"은 ' ', 빈 칸은 0)
+"""
+
+import argparse
+import difflib
+import json
+import re
+import sys
+
+FONT_FIRST = 0x20
+FONT_SIZE = 96
+PATTERN_BYTES = 3
+SPACE_NAMES = ("공백", "space", "SP")
+
+
+def parse_font_table(path):
+    """font-table.md → (세그먼트 수, [(문자, 패턴)]) (표 순서 유지)"""
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+
+    segments = None
+    rows = []
+    for number, line in enumerate(lines, 1):
+        cells = [c.strip() for c in line.strip().strip("|").split("|")] if line.startswith("|") else None
+
+        if segments is None:
+            if cells and cells[0] == "문자":
+                names = cells[1:]
+                expected = ["P%d" % i for i in range(len(names))]
+                if names != expected:
+                    raise ValueError("line %d: segment columns must be P0..P%d in order" % (number, len(names) - 1))
+                segments = len(names)
+            continue
+
+        if cells is None:
+            if rows:
+                break                     # 표 끝
+            continue
+        if all(re.fullmatch(r":?-+:?", c) for c in cells):
+            continue                      # 구분 행
+
+        name, bits = cells[0], cells[1:]
+        if name in SPACE_NAMES:
+            char = " "
+        elif len(name) == 1 and FONT_FIRST <= ord(name) < FONT_FIRST + FONT_SIZE:
+            char = name
+        else:
+            raise ValueError("line %d: unsupported character cell %r" % (number, name))
+        if len(bits) != segments:
+            raise ValueError("line %d: %r has %d segment cells, expected %d" % (number, name, len(bits), segments))
+
+        pattern = 0
+        for index, bit in enumerate(bits):
+            if bit not in ("0", "1", ""):
+                raise ValueError("line %d: %r P%d is %r, expected 0/1" % (number, name, index, bit))
+            if bit == "1":
+                pattern |= 1 << index
+        if any(c == char for c, _ in rows):
+            raise ValueError("line %d: %r defined twice" % (number, name))
+        rows.append((char, pattern))
+
+    if segments is None:
+        raise ValueError("no |문자|P0|... table found")
+    if segments > PATTERN_BYTES * 8:
+        raise ValueError("%d segments do not fit the %d-byte packed pattern" % (segments, PATTERN_BYTES))
+    missing = [d for d in "0123456789" if not any(c == d for c, _ in rows)]
+    if missing:
+        raise ValueError("digits missing from table: " + " ".join(missing))
+
+    return segments, rows
+
+
+def connection_segments(path):
+    with open(path, encoding="utf-8") as f:
+        table = json.load(f)
+    return table["model"], table["segments"]
+
+
+def dense_patterns(rows):
+    """문자 코드 0x20-0x7F → (패턴, 지원 여부)"""
+    table = dict(rows)
+    dense = []
+    for code in range(FONT_FIRST, FONT_FIRST + FONT_SIZE):
+        char = chr(code)
+        if char not in table and char.islower():
+            char = char.upper()
+        dense.append((table.get(char, 0), char in table))
+    return dense
+
+
+def char_label(code):
+    char = chr(code)
+    if code == 0x7F:
+        return "DEL"
+    if char in "'\\":
+        return "'\\%s'" % char
+    return "'%s'" % char
+
+
+def verify(segments, rows):
+    """검증 보고서 줄 목록과 경고 줄 목록"""
+    report = []
+    warnings = []
+
+    report.append("characters: %d (%s)" % (len(rows), "".join(c for c, _ in rows)))
+    lowercase = [chr(c) for c in range(ord("a"), ord("z") + 1) if chr(c).upper() in dict(rows) and chr(c) not in dict(rows)]
+    if lowercase:
+        report.append("lowercase folded to uppercase: %s" % "".join(lowercase))
+
+    usage = [sum(1 for _, p in rows if p >> s & 1) for s in range(segments)]
+    report.append("segment usage: " + " ".join("P%d=%d" % (s, n) for s, n in enumerate(usage)))
+    unused = ["P%d" % s for s, n in enumerate(usage) if n == 0]
+    if unused:
+        warnings.append("segments never lit: " + " ".join(unused))
+
+    groups = {}
+    for char, pattern in rows:
+        if char != " ":
+            groups.setdefault(pattern, []).append(char)
+    for pattern, chars in groups.items():
+        if len(chars) < 2:
+            continue
+        line = "same pattern 0x%06X: %s" % (pattern, " ".join("'%s'" % c for c in chars))
+        report.append(line)
+        if any(c.isalnum() for c in chars):
+            warnings.append(line)
+
+    blank = [c for c, p in rows if p == 0 and c != " "]
+    if blank:
+        warnings.append("characters with no segments: " + " ".join("'%s'" % c for c in blank))
+
+    return report, warnings
+
+
+def generate(md_path, model, segments, rows):
+    prefix = "VFD_%s" % re.sub(r"\W", "_", model.upper())
+    source = md_path.replace("\\", "/")
+    width = (segments + 3) // 4
+    dense = dense_patterns(rows)
+    table = dict(rows)
+
+    def pat(pattern):
+        return "PAT(0x%0*X)" % (width, pattern)
+
+    lines = []
+    out = lines.append
+
+    out("/*")
+    out(" * %s_FontTable.cpp" % prefix)
+    out(" * ")
+    out(" * Packed font tables for %s VFD display (%d segments)" % (model, segments))
+    out(" * ")
+    out(" * AUTO-GENERATED by tools/gen_font_table.py from %s" % source)
+    out(" * 직접 수정하지 말고 폰트 표를 수정한 뒤 다시 생성할 것")
+    out(" */")
+    out("")
+    out('#include "%s_Font.h"' % prefix)
+    out("")
+    out("#define PAT MAX6921_PACK_PATTERN")
+    out("")
+    out("// 문자 코드 (0x20 ~ 0x7F) → %d비트 패턴, 3바이트씩 (표에 없는 문자는 공백, 소문자는 대문자 패턴)" % segments)
+    out("const uint8_t %s_FONT_DENSE[%d * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {" % (prefix, FONT_SIZE))
+    for base in range(0, FONT_SIZE, 4):
+        values = ", ".join(pat(dense[base + i][0]) for i in range(4))
+        labels = " ".join(char_label(FONT_FIRST + base + i) for i in range(4))
+        out("    %s,  // %s" % (values, labels))
+    out("};")
+    out("")
+    out("// 숫자 0-9 → 패턴")
+    out("const uint8_t %s_FONT_DIGITS[10 * MAX6921_FONT_PATTERN_BYTES] PROGMEM = {" % prefix)
+    out("    %s,  // 0-4" % ", ".join(pat(table[str(d)]) for d in range(5)))
+    out("    %s   // 5-9" % ", ".join(pat(table[str(d)]) for d in range(5, 10)))
+    out("};")
+    out("")
+    out("// 문자 코드 (0x20 ~ 0x7F) → 지원 여부 (1비트/문자, bit n = 코드 0x20 + 8k + n)")
+    supported = []
+    for base in range(0, FONT_SIZE, 8):
+        byte = 0
+        for bit in range(8):
+            if dense[base + bit][1]:
+                byte |= 1 << bit
+        supported.append("0x%02X" % byte)
+    out("const uint8_t %s_FONT_SUPPORTED[%d] PROGMEM = {" % (prefix, FONT_SIZE // 8))
+    out("    " + ", ".join(supported))
+    out("};")
+    out("")
+    out("#undef PAT")
+    out("")
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate packed VFD font tables from font-table.md")
+    parser.add_argument("table", help="font-table.md")
+    parser.add_argument("-o", "--output", required=True, help="source file to write")
+    parser.add_argument("--model", help="model name (default: connection table model or table directory name)")
+    parser.add_argument("--connection", help="connection table JSON (segment count cross-check)")
+    parser.add_argument("--check", action="store_true",
+                        help="compare against the existing file instead of writing it")
+    parser.add_argument("--report", action="store_true", help="print the verification report")
+    args = parser.parse_args()
+
+    try:
+        segments, rows = parse_font_table(args.table)
+        model = args.model
+        if args.connection:
+            json_model, json_segments = connection_segments(args.connection)
+            if json_segments != segments:
+                raise ValueError("%d segment columns, but %s declares %d segments"
+                                 % (segments, args.connection, json_segments))
+            model = model or json_model
+        if not model:
+            parts = args.table.replace("\\", "/").split("/")
+            model = parts[-2] if len(parts) >= 2 else "FONT"
+        source = generate(args.table, model, segments, rows)
+    except (KeyError, ValueError, OSError) as error:
+        print("error: %s: %s" % (args.table, error), file=sys.stderr)
+        return 2
+
+    report, warnings = verify(segments, rows)
+    if args.report:
+        print("%s: %d segments" % (model, segments))
+        for line in report:
+            print("  " + line)
+    for line in warnings:
+        print("warning: %s: %s" % (args.table, line), file=sys.stderr)
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != source:
+            sys.stdout.writelines(difflib.unified_diff(
+                current.splitlines(True), source.splitlines(True),
+                args.output, "generated"))
+            print("%s is out of date, regenerate it" % args.output, file=sys.stderr)
+            return 1
+        print("%s is up to date" % args.output)
+        return 0
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(source)
+    print("wrote %s" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
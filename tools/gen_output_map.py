@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+gen_output_map.py
+
+VFD 연결 테이블(JSON)로부터 MAX6921 체인 출력 맵 헤더를 생성합니다.
+
+    python3 tools/gen_output_map.py vfd-configs/connection-tables/7BT317NK.json \
+        -o arduino/examples/TEST/VFD_7BT317NK_Map.h
+
+--check 옵션을 주면 파일을 쓰지 않고, 기존 헤더가 JSON에서 새로 생성한
+결과와 같은지만 확인합니다 (다르면 종료 코드 1). 연결 테이블을 수정한 뒤
+헤더를 다시 생성하지 않은 경우를 빌드 전에 잡기 위한 용도입니다.
+
+체인 비트 번호: 칩 #1(MCU 쪽) OUT0 = 0, 칩 #c OUTn = (c-1)*20 + n
+프레임 형식은 arduino/MAX6921_VFD_Driver/MAX6921_Transport.h 참조
+"""
+
+import argparse
+import difflib
+import json
+import re
+import sys
+
+MAX6921_OUTPUT_BITS = 20
+
+
+def chain_bytes(chips):
+    return (chips * MAX6921_OUTPUT_BITS + 7) // 8
+
+
+def frame_position(bit, frame_bytes):
+    """체인 비트 → (프레임 바이트 인덱스, 비트 마스크)"""
+    return frame_bytes - 1 - (bit >> 3), 1 << (bit & 7)
+
+
+def load_table(path):
+    with open(path, encoding="utf-8") as f:
+        table = json.load(f)
+
+    model = table["model"]
+    chips = table["chips"]
+    grids = table["grids"]
+    segments = table["segments"]
+
+    grid_bits = [None] * grids
+    segment_bits = [None] * segments
+    used = {}
+
+    for entry in table["outputs"]:
+        chip = entry["chip"]
+        output = entry["output"]
+        signal = entry["signal"]
+
+        if not 1 <= chip <= chips:
+            raise ValueError("%s: chip %d out of range (1-%d)" % (signal, chip, chips))
+        if not 0 <= output < MAX6921_OUTPUT_BITS:
+            raise ValueError("%s: output %d out of range (0-19)" % (signal, output))
+
+        bit = (chip - 1) * MAX6921_OUTPUT_BITS + output
+        if bit in used:
+            raise ValueError("chain bit %d used by both %s and %s" % (bit, used[bit], signal))
+        used[bit] = signal
+
+        match = re.fullmatch(r"([GP])(\d+)", signal)
+        if not match:
+            raise ValueError("unknown signal name: %s" % signal)
+        kind, index = match.group(1), int(match.group(2))
+        target = grid_bits if kind == "G" else segment_bits
+        if index >= len(target):
+            raise ValueError("%s exceeds declared %s count" % (signal, "grid" if kind == "G" else "segment"))
+        target[index] = bit
+
+    missing = ["G%d" % i for i, b in enumerate(grid_bits) if b is None]
+    missing += ["P%d" % i for i, b in enumerate(segment_bits) if b is None]
+    if missing:
+        raise ValueError("unmapped signals: " + ", ".join(missing))
+
+    return model, chips, grid_bits, segment_bits
+
+
+def c_bytes(values):
+    return ", ".join("0x%02X" % v for v in values)
+
+
+def generate(json_path, model, chips, grid_bits, segment_bits):
+    frame_bytes = chain_bytes(chips)
+    prefix = "VFD_%s" % re.sub(r"\W", "_", model.upper())
+    guard = "%s_MAP_H" % prefix
+    source = json_path.replace("\\", "/")
+
+    lines = []
+    out = lines.append
+
+    out("/*")
+    out(" * %s_Map.h" % prefix)
+    out(" * ")
+    out(" * MAX6921 chain output map for %s VFD display" % model)
+    out(" * ")
+    out(" * AUTO-GENERATED by tools/gen_output_map.py from %s" % source)
+    out(" * 직접 수정하지 말고 연결 테이블을 수정한 뒤 다시 생성할 것")
+    out(" */")
+    out("")
+    out("#ifndef %s" % guard)
+    out("#define %s" % guard)
+    out("")
+    out("#include <Arduino.h>")
+    out("")
+    out("#define %s_MAP_GRIDS        %d" % (prefix, len(grid_bits)))
+    out("#define %s_MAP_SEGMENTS     %d" % (prefix, len(segment_bits)))
+    out("#define %s_MAP_CHIPS        %d" % (prefix, chips))
+    out("#define %s_MAP_FRAME_BYTES  %d" % (prefix, frame_bytes))
+    out("")
+
+    out("// 그리드 Gn → 체인 비트")
+    out("constexpr uint8_t %s_GRID_CHAIN_BIT[%d] PROGMEM = {" % (prefix, len(grid_bits)))
+    out("    " + ", ".join(str(b) for b in grid_bits))
+    out("};")
+    out("")
+
+    out("// 세그먼트 Pn → 체인 비트")
+    out("constexpr uint8_t %s_SEGMENT_CHAIN_BIT[%d] PROGMEM = {" % (prefix, len(segment_bits)))
+    out("    " + ", ".join(str(b) for b in segment_bits))
+    out("};")
+    out("")
+
+    out("// 그리드 Gn 선택 비트만 켜진 전송 프레임 (세그먼트는 인코딩 시 OR)")
+    out("constexpr uint8_t %s_GRID_FRAME[%d][%d] PROGMEM = {" % (prefix, len(grid_bits), frame_bytes))
+    for index, bit in enumerate(grid_bits):
+        frame = [0] * frame_bytes
+        byte, mask = frame_position(bit, frame_bytes)
+        frame[byte] |= mask
+        out("    { %s },  // G%d" % (c_bytes(frame), index))
+    out("};")
+    out("")
+
+    out("// 세그먼트 Pn → 전송 프레임 바이트 인덱스 / 비트 마스크")
+    positions = [frame_position(bit, frame_bytes) for bit in segment_bits]
+    out("constexpr uint8_t %s_SEGMENT_FRAME_BYTE[%d] PROGMEM = {" % (prefix, len(segment_bits)))
+    out("    " + ", ".join(str(p[0]) for p in positions))
+    out("};")
+    out("constexpr uint8_t %s_SEGMENT_FRAME_MASK[%d] PROGMEM = {" % (prefix, len(segment_bits)))
+    out("    " + c_bytes(p[1] for p in positions))
+    out("};")
+    out("")
+    out("#endif // %s" % guard)
+    out("")
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate MAX6921 chain output map header")
+    parser.add_argument("table", help="connection table JSON")
+    parser.add_argument("-o", "--output", required=True, help="header file to write")
+    parser.add_argument("--check", action="store_true",
+                        help="compare against the existing header instead of writing it")
+    args = parser.parse_args()
+
+    try:
+        header = generate(args.table, *load_table(args.table))
+    except (KeyError, ValueError) as error:
+        print("error: %s: %s" % (args.table, error), file=sys.stderr)
+        return 2
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != header:
+            sys.stdout.writelines(difflib.unified_diff(
+                current.splitlines(True), header.splitlines(True),
+                args.output, "generated"))
+            print("%s is out of date, regenerate it" % args.output, file=sys.stderr)
+            return 1
+        print("%s is up to date" % args.output)
+        return 0
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("wrote %s" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
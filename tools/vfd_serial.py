@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+"""
+vfd_serial.py
+
+MAX6921 VFD 스트리밍 시리얼 프로토콜의 호스트 쪽 기준 인코더와 측정 도구입니다.
+프레임 형식은 arduino/MAX6921_VFD_Driver/MAX6921_SerialProtocol.h 참조
+
+    0xA5 | CMD | LEN | PAYLOAD[LEN] | CRC8 (다항식 0x07, CMD + LEN + PAYLOAD)
+
+명령 전송 (pyserial 필요):
+
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 text "12.34"
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 grids 0 0x1FFFFF 0x000001
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 brightness 128 --fade 500
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 effect marquee 0 7 200 --text "HELLO WORLD"
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 effect stop
+
+지연/처리량 측정 (보드에서 MAX6921_SerialProtocol이 응답을 보내는 스케치 실행, 예: examples/TEST):
+
+    python3 tools/vfd_serial.py -p /dev/ttyUSB0 -b 115200 bench --count 500 --seconds 5
+
+  - latency: TEXT 프레임 1개를 보내고 응답(명령 반영 완료)까지의 왕복 시간
+  - rate: 응답을 기다리지 않고 --window개까지 겹쳐 보내며 초당 반영된 갱신 수
+  - wire_limit: 보율 기준 이론 최대 갱신 수 (바이트당 10비트)
+
+보드 없이 인코더/파서 확인 (펌웨어 상태 기계와 같은 기준 파서로 왕복 검사):
+
+    python3 tools/vfd_serial.py selftest
+"""
+
+import argparse
+import statistics
+import sys
+import time
+
+SYNC = 0xA5
+REPLY = 0x80
+CRC_ERROR_CMD = 0x7F
+MAX_PAYLOAD = 64
+RING_SIZE = 128
+
+CMD_TEXT = 0x01
+CMD_GRIDS = 0x02
+CMD_BRIGHTNESS = 0x03
+CMD_EFFECT = 0x04
+CMD_PING = 0x05
+
+EFFECTS = {"stop": 0, "marquee": 1, "blink": 2, "wipe": 3, "crossfade": 4}
+
+STATUS = ["ok", "bad_length", "bad_argument", "unknown_command", "crc_error"]
+
+
+def crc8(data, crc=0):
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def encode_frame(command, payload=b""):
+    payload = bytes(payload)
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload %d bytes exceeds %d" % (len(payload), MAX_PAYLOAD))
+    body = bytes([command, len(payload)]) + payload
+    return bytes([SYNC]) + body + bytes([crc8(body)])
+
+
+def encode_text(text):
+    return encode_frame(CMD_TEXT, text.encode("ascii"))
+
+
+def encode_grids(first, masks, segments=21):
+    """그리드별 세그먼트 마스크 (그리드당 (segments + 7) // 8바이트, 리틀 엔디언)"""
+    width = (segments + 7) // 8
+    payload = bytes([first])
+    for mask in masks:
+        payload += (mask & ((1 << segments) - 1)).to_bytes(width, "little")
+    return encode_frame(CMD_GRIDS, payload)
+
+
+def encode_brightness(level, fade_ms=None):
+    payload = bytes([level])
+    if fade_ms is not None:
+        payload += fade_ms.to_bytes(2, "little")
+    return encode_frame(CMD_BRIGHTNESS, payload)
+
+
+def encode_effect(kind, first=0, count=0, interval_ms=0, arg=0, text=""):
+    effect = EFFECTS[kind] if isinstance(kind, str) else kind
+    if effect == 0:
+        return encode_frame(CMD_EFFECT, bytes([0]))
+    payload = bytes([effect, first, count]) + interval_ms.to_bytes(2, "little") + bytes([arg])
+    return encode_frame(CMD_EFFECT, payload + text.encode("ascii"))
+
+
+def encode_ping(payload=b""):
+    return encode_frame(CMD_PING, payload)
+
+
+class Decoder:
+    """펌웨어(MAX6921_SerialProtocol::parse)와 같은 상태 기계. 완성된 프레임을 돌려줌"""
+
+    def __init__(self):
+        self.state = "sync"
+        self.errors = 0
+        self.frames = []
+
+    def feed(self, data):
+        for byte in data:
+            self._byte(byte)
+        frames, self.frames = self.frames, []
+        return frames
+
+    def _byte(self, byte):
+        if self.state == "sync":
+            if byte == SYNC:
+                self.state, self.crc = "command", 0
+        elif self.state == "command":
+            self.command, self.crc = byte, crc8([byte], self.crc)
+            self.state = "length"
+        elif self.state == "length":
+            if byte > MAX_PAYLOAD:
+                self.errors += 1
+                self.state = "sync"
+                return
+            self.length, self.crc = byte, crc8([byte], self.crc)
+            self.payload = bytearray()
+            self.state = "payload" if byte else "crc"
+        elif self.state == "payload":
+            self.payload.append(byte)
+            self.crc = crc8([byte], self.crc)
+            if len(self.payload) == self.length:
+                self.state = "crc"
+        else:
+            self.state = "sync"
+            if byte != self.crc:
+                self.errors += 1
+                self.frames.append((CRC_ERROR_CMD, None))
+            else:
+                self.frames.append((self.command, bytes(self.payload)))
+
+
+def selftest():
+    frames = [
+        encode_text("12.34"),
+        encode_grids(2, [0x1FFFFF, 0x000001]),
+        encode_brightness(128),
+        encode_brightness(0, 500),
+        encode_effect("marquee", 0, 7, 200, 1, "HELLO WORLD"),
+        encode_effect("stop"),
+        encode_ping(b"\x00\xA5\xFF"),
+    ]
+
+    # 줄 모드 텍스트와 잡음 사이에 프레임을 섞고 한 바이트씩 해석
+    stream = b"typed text\r\n"
+    for frame in frames:
+        stream += b"\x13" + frame
+    corrupt = bytearray(encode_text("X"))
+    corrupt[-1] ^= 0x01
+    stream += bytes(corrupt) + bytes([SYNC, CMD_TEXT, MAX_PAYLOAD + 1]) + encode_ping()
+
+    decoder = Decoder()
+    decoded = []
+    for byte in stream:
+        decoded += decoder.feed([byte])
+
+    expected = [(f[1], f[3:-1]) for f in frames] + [(CRC_ERROR_CMD, None), (CMD_PING, b"")]
+    if decoded != expected:
+        print("selftest failed:\n  expected %r\n  decoded  %r" % (expected, decoded), file=sys.stderr)
+        return 1
+    if decoder.errors != 2:
+        print("selftest failed: %d errors, expected 2" % decoder.errors, file=sys.stderr)
+        return 1
+
+    for frame in frames:
+        print(frame.hex(" "))
+    print("selftest passed (%d frames, %d bytes)" % (len(frames), len(stream)))
+    return 0
+
+
+def open_port(args):
+    try:
+        import serial
+    except ImportError:
+        print("error: pyserial is required (pip install pyserial)", file=sys.stderr)
+        sys.exit(2)
+    port = serial.Serial(args.port, args.baud, timeout=args.timeout)
+    # 포트를 열면 보드가 리셋되므로 부트로더가 끝날 때까지 대기
+    time.sleep(args.settle)
+    port.reset_input_buffer()
+    return port
+
+
+def read_reply(port, decoder):
+    while True:
+        data = port.read(1)
+        if not data:
+            return None
+        for command, payload in decoder.feed(data):
+            if command == CRC_ERROR_CMD:
+                return command, STATUS.index("crc_error")
+            if command & REPLY and payload is not None and len(payload) == 1:
+                return command & ~REPLY, payload[0]
+
+
+def send(args, frame):
+    port = open_port(args)
+    port.write(frame)
+    reply = read_reply(port, Decoder())
+    if reply is None:
+        print("no reply", file=sys.stderr)
+        return 1
+    print(STATUS[reply[1]] if reply[1] < len(STATUS) else "status %d" % reply[1])
+    return 0 if reply[1] == 0 else 1
+
+
+def bench(args):
+    port = open_port(args)
+    decoder = Decoder()
+    width = args.digits
+
+    # 왕복 지연: 프레임 1개씩
+    samples = []
+    for i in range(args.count):
+        frame = encode_text(str(i % 10 ** width).rjust(width))
+        start = time.perf_counter()
+        port.write(frame)
+        reply = read_reply(port, decoder)
+        if reply is None or reply[1] != 0:
+            print("latency: frame %d failed (%r)" % (i, reply), file=sys.stderr)
+            return 1
+        samples.append((time.perf_counter() - start) * 1000.0)
+
+    frame_bytes = len(encode_text("0" * width))
+    wire_ms = (frame_bytes + 5) * 10 * 1000.0 / args.baud
+    samples.sort()
+
+    # 처리량: 응답을 기다리지 않고 window개까지 겹쳐 보냄
+    sent = acked = failed = 0
+    deadline = time.perf_counter() + args.seconds
+    start = time.perf_counter()
+    while time.perf_counter() < deadline or acked + failed < sent:
+        while sent - acked - failed < args.window and time.perf_counter() < deadline:
+            port.write(encode_text(str(sent % 10 ** width).rjust(width)))
+            sent += 1
+        reply = read_reply(port, decoder)
+        if reply is None:
+            break
+        if reply[1] == 0:
+            acked += 1
+        else:
+            failed += 1
+    elapsed = time.perf_counter() - start
+
+    print("metric,value")
+    print("baud,%d" % args.baud)
+    print("frame_bytes,%d" % frame_bytes)
+    print("latency_min_ms,%.2f" % samples[0])
+    print("latency_avg_ms,%.2f" % statistics.mean(samples))
+    print("latency_p50_ms,%.2f" % samples[len(samples) // 2])
+    print("latency_p99_ms,%.2f" % samples[min(len(samples) - 1, len(samples) * 99 // 100)])
+    print("latency_max_ms,%.2f" % samples[-1])
+    print("latency_wire_ms,%.2f" % wire_ms)
+    print("rate_window,%d" % args.window)
+    print("rate_updates_per_s,%.1f" % (acked / elapsed))
+    print("rate_sent,%d" % sent)
+    print("rate_failed,%d" % failed)
+    print("rate_lost,%d" % (sent - acked - failed))
+    print("wire_limit_updates_per_s,%.1f" % (args.baud / 10.0 / frame_bytes))
+    return 0 if failed == 0 and acked == sent else 1
+
+
+def parse_int(text):
+    return int(text, 0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="MAX6921 VFD serial protocol encoder and benchmark")
+    parser.add_argument("-p", "--port", help="serial port (e.g. /dev/ttyUSB0)")
+    parser.add_argument("-b", "--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=1.0, help="reply timeout in seconds")
+    parser.add_argument("--settle", type=float, default=2.0, help="wait after opening the port (board reset)")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    command = commands.add_parser("text", help="display a string")
+    command.add_argument("text")
+
+    command = commands.add_parser("grids", help="write raw segment masks starting at a grid")
+    command.add_argument("first", type=int)
+    command.add_argument("masks", type=parse_int, nargs="+")
+    command.add_argument("--segments", type=int, default=21)
+
+    command = commands.add_parser("brightness", help="set brightness (0-255)")
+    command.add_argument("level", type=int)
+    command.add_argument("--fade", type=int, help="fade duration in ms")
+
+    command = commands.add_parser("effect", help="start an effect or stop all effects")
+    command.add_argument("kind", choices=sorted(EFFECTS))
+    command.add_argument("first", type=int, nargs="?", default=0)
+    command.add_argument("count", type=int, nargs="?", default=0)
+    command.add_argument("interval", type=int, nargs="?", default=0, help="step/period/duration in ms")
+    command.add_argument("--arg", type=int, default=1, help="marquee: repeat (0/1), blink: times (0 = forever)")
+    command.add_argument("--text", default="")
+
+    command = commands.add_parser("bench", help="measure update latency and sustainable rate")
+    command.add_argument("--count", type=int, default=200, help="latency samples")
+    command.add_argument("--seconds", type=float, default=5.0, help="rate test duration")
+    command.add_argument("--window", type=int, default=4, help="frames in flight during the rate test")
+    command.add_argument("--digits", type=int, default=7, help="text length per update")
+
+    commands.add_parser("selftest", help="round-trip the encoder through the reference parser")
+
+    args = parser.parse_args()
+
+    if args.command == "selftest":
+        return selftest()
+    if not args.port:
+        parser.error("--port is required for %s" % args.command)
+
+    try:
+        if args.command == "text":
+            return send(args, encode_text(args.text))
+        if args.command == "grids":
+            return send(args, encode_grids(args.first, args.masks, args.segments))
+        if args.command == "brightness":
+            return send(args, encode_brightness(args.level, args.fade))
+        if args.command == "effect":
+            return send(args, encode_effect(args.kind, args.first, args.count, args.interval, args.arg, args.text))
+        if args.command == "bench":
+            if args.window * (len(encode_text("0" * args.digits))) > RING_SIZE:
+                parser.error("--window x frame size exceeds the %d-byte receive ring" % RING_SIZE)
+            return bench(args)
+    except ValueError as error:
+        print("error: %s" % error, file=sys.stderr)
+        return 2
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())